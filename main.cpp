@@ -28,7 +28,41 @@
 #include <wx/button.h>  // For wxButton
 #include <wx/log.h>
 #include <wx/dialog.h>
+#include <wx/filename.h>  // For wxFileName (data file timestamps)
+#include <wx/file.h>  // For wxFile (snapshot writes with fsync)
+#include <wx/wfstream.h>  // For wxFileOutputStream (snapshots streamed to the file)
+#include <wx/mstream.h>  // For wxMemoryInputStream/wxMemoryOutputStream
+#include <wx/zstream.h>  // For wxZlibInputStream/wxZlibOutputStream (compressed snapshots)
+#include <wx/dir.h>  // For wxDir (delta sync drop directory)
+#include <wx/fswatcher.h>  // For wxFileSystemWatcher (external edits of the data file)
+#include <wx/timer.h>  // For wxTimer (coalescing file system events)
+#ifdef __WXMSW__
+#include <wx/msw/wrapwin.h>  // For MoveFileEx and file mappings
+#else
+#include <fcntl.h>      // For open
+#include <sys/mman.h>   // For mmap
+#include <sys/stat.h>   // For fstat
+#include <unistd.h>     // For close
+#endif
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory_resource>
+#include <mutex>
+#include <shared_mutex>
+#include <random>
+#include <set>
+#include <string_view>
+#include <thread>
+#include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
+#include <variant>
 #pragma warning( pop )
 
 using json = nlohmann::json;
@@ -41,10 +75,99 @@ namespace ChoreAppNamespace {
     // Define the data file path
     const wxString DATA_FILE_PATH = "TestData\\";
 
+    // Set by the command line modes, where nobody is there to dismiss a dialog
+    inline bool runningHeadless = false;
+
+    // Report an error in a message box, or in the log when running headless
+    inline void showError(const wxString& message, const wxString& caption) {
+        if (runningHeadless) {
+            wxLogError("%s: %s", caption, message);
+        }
+        else {
+            wxMessageBox(message, caption, wxOK | wxICON_ERROR);
+        }
+    }
+
     // Enumerations for difficulty, status, and priority
     enum class DIFFICULTY { EASY, MEDIUM, HARD };
     enum class STATUS { NOT_STARTED, IN_PROGRESS, COMPLETED };
     enum class PRIORITY { LOW, MODERATE, HIGH };
+    enum class WEEKDAY { MONDAY, TUESDAY, WEDNESDAY, THURSDAY, FRIDAY, SATURDAY, SUNDAY };
+    // Kind of change reported by a Chore to its update callback
+    enum class CHANGE { FIELDS, STATUS };
+    // Snapshot file formats: indented or compact JSON text, or CBOR/MessagePack binary (smaller and faster to parse)
+    enum class SNAPSHOT_FORMAT { JSON, JSON_COMPACT, CBOR, MSGPACK };
+
+    inline bool isTextFormat(SNAPSHOT_FORMAT format) {
+        return format == SNAPSHOT_FORMAT::JSON || format == SNAPSHOT_FORMAT::JSON_COMPACT;
+    }
+
+    // Pass each byte of a text JSON value to emit, skipping the whitespace between its tokens
+    template <typename Emit>
+    inline void minifyJSON(const char* data, size_t size, Emit emit) {
+        bool inString = false;
+        for (size_t i = 0; i < size; i++) {
+            char c = data[i];
+            if (inString) {
+                emit(c);
+                if (c == '\\' && i + 1 < size) {
+                    emit(data[++i]);
+                }
+                else if (c == '"') {
+                    inString = false;
+                }
+            }
+            else if (c == '"') {
+                inString = true;
+                emit(c);
+            }
+            else if (!isspace(static_cast<unsigned char>(c))) {
+                emit(c);
+            }
+        }
+    }
+
+    // Append a text JSON value without the whitespace between its tokens
+    inline void appendMinifiedJSON(std::string& out, const char* data, size_t size) {
+        minifyJSON(data, size, [&out](char c) { out += c; });
+    }
+
+    // Length of a text JSON value once minified, without building it
+    inline size_t minifiedJSONSize(const char* data, size_t size) {
+        size_t length = 0;
+        minifyJSON(data, size, [&length](char) { length++; });
+        return length;
+    }
+
+    // Encode one chore the way it appears inside the "chores" array of a snapshot
+    // (text fragments are indented for their place in the 4-space indented document)
+    inline std::string serializeChoreFragment(const json& choreJson, SNAPSHOT_FORMAT format) {
+        std::string bytes;
+        switch (format) {
+        case SNAPSHOT_FORMAT::CBOR:
+            json::to_cbor(choreJson, bytes);
+            break;
+        case SNAPSHOT_FORMAT::MSGPACK:
+            json::to_msgpack(choreJson, bytes);
+            break;
+        case SNAPSHOT_FORMAT::JSON_COMPACT:
+            bytes = choreJson.dump();
+            break;
+        default: {
+            std::string text = choreJson.dump(4);
+            bytes.reserve(text.size() + text.size() / 8);
+            bytes += "        ";
+            for (char c : text) {
+                bytes += c;
+                if (c == '\n') {
+                    bytes += "        ";
+                }
+            }
+            break;
+        }
+        }
+        return bytes;
+    }
 
 
     //********************************************************************************************************************
@@ -199,6 +322,242 @@ namespace ChoreAppNamespace {
     };
 
 
+    //********************************************************************************************************************
+    // StringPool interns the short, repetitive text of chores (frequency, location, tags, tools, ...): each distinct
+    // string is stored once and chores hold a 32-bit Symbol, so comparing, grouping and filtering on these fields
+    // compares integers. The pool grows with the vocabulary, not with the number of chores; symbols are never freed.
+    using Symbol = uint32_t;
+    using SymbolList = std::pmr::vector<Symbol>;
+
+    class StringPool {
+    private:
+        std::deque<wxString> strings;                   // By symbol; a deque never moves its elements
+        std::unordered_map<std::string, Symbol> symbols;
+        mutable std::shared_mutex mutex;                // Chores are built on several threads at once
+
+    public:
+        static constexpr Symbol EMPTY = 0;
+
+        StringPool() {
+            intern(std::string());
+        }
+
+        // The pool shared by every chore
+        static StringPool& global() {
+            static StringPool pool;
+            return pool;
+        }
+
+        Symbol intern(const std::string& text) {
+            {
+                std::shared_lock<std::shared_mutex> lock(mutex);
+                auto found = symbols.find(text);
+                if (found != symbols.end()) {
+                    return found->second;
+                }
+            }
+            std::unique_lock<std::shared_mutex> lock(mutex);
+            auto inserted = symbols.emplace(text, static_cast<Symbol>(strings.size()));
+            if (inserted.second) {
+                strings.emplace_back(text);
+            }
+            return inserted.first->second;
+        }
+
+        Symbol intern(const wxString& text) {
+            return intern(text.ToStdString());
+        }
+
+        // Symbol of text if it was ever interned, without adding it; lets filters skip unknown values
+        bool find(const std::string& text, Symbol& symbol) const {
+            std::shared_lock<std::shared_mutex> lock(mutex);
+            auto found = symbols.find(text);
+            if (found == symbols.end()) {
+                return false;
+            }
+            symbol = found->second;
+            return true;
+        }
+
+        const wxString& str(Symbol symbol) const {
+            std::shared_lock<std::shared_mutex> lock(mutex);
+            return strings[symbol];
+        }
+
+        size_t size() const {
+            std::shared_lock<std::shared_mutex> lock(mutex);
+            return strings.size();
+        }
+    };
+
+    inline Symbol intern(const std::string& text) {
+        return StringPool::global().intern(text);
+    }
+
+    inline Symbol intern(const wxString& text) {
+        return StringPool::global().intern(text);
+    }
+
+    inline const wxString& symbolText(Symbol symbol) {
+        return StringPool::global().str(symbol);
+    }
+
+    inline vector<wxString> symbolTexts(const SymbolList& symbols) {
+        vector<wxString> texts;
+        texts.reserve(symbols.size());
+        for (Symbol symbol : symbols) {
+            texts.push_back(symbolText(symbol));
+        }
+        return texts;
+    }
+
+    inline void internAll(const vector<wxString>& texts, SymbolList& symbols) {
+        symbols.clear();
+        symbols.reserve(texts.size());
+        for (const auto& text : texts) {
+            symbols.push_back(intern(text));
+        }
+    }
+
+    //********************************************************************************************************************
+    // The days a chore is due, one bit per WEEKDAY (bit 0 = Monday). Files keep the day names; the mask is what
+    // scheduling queries test, so "due on Tuesday" or "due on any of these days" is a single AND
+    using DayMask = uint8_t;
+
+    constexpr DayMask NO_DAYS = 0;
+    constexpr DayMask ALL_DAYS = 0x7F;
+    constexpr size_t WEEKDAY_COUNT = 7;
+
+    inline DayMask dayBit(WEEKDAY day) {
+        return static_cast<DayMask>(1u << static_cast<unsigned>(day));
+    }
+
+    inline const char* weekdayName(WEEKDAY day) {
+        static const char* names[WEEKDAY_COUNT] = { "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday", "Sunday" };
+        return names[static_cast<size_t>(day)];
+    }
+
+    // Bit of a day name, matched case-insensitively on the full name or an abbreviation of at least three letters
+    // ("Tue", "Tues", "Thurs"); other names ("Daily", "Weekdays") give 0
+    inline DayMask dayMaskFromName(const std::string& name) {
+        if (name.size() < 3) {
+            return NO_DAYS;
+        }
+        for (size_t day = 0; day < WEEKDAY_COUNT; day++) {
+            const std::string full = weekdayName(static_cast<WEEKDAY>(day));
+            if (name.size() > full.size()) {
+                continue;
+            }
+            bool same = true;
+            for (size_t i = 0; i < name.size() && same; i++) {
+                same = std::tolower(static_cast<unsigned char>(name[i])) == std::tolower(static_cast<unsigned char>(full[i]));
+            }
+            if (same) {
+                return dayBit(static_cast<WEEKDAY>(day));
+            }
+        }
+        return NO_DAYS;
+    }
+
+    // Day names of a mask, Monday first
+    inline vector<wxString> dayMaskNames(DayMask mask) {
+        vector<wxString> names;
+        for (size_t day = 0; day < WEEKDAY_COUNT; day++) {
+            if (mask & dayBit(static_cast<WEEKDAY>(day))) {
+                names.push_back(weekdayName(static_cast<WEEKDAY>(day)));
+            }
+        }
+        return names;
+    }
+
+    //********************************************************************************************************************
+    // ChoreArena is the memory of the chores built by one bulk load: blocks are carved one after another out of
+    // large chunks (a monotonic buffer) that are never returned individually. Chores made by Chore::create keep
+    // their arena alive through their shared_ptr control block, so a chore still held by a frame after a reload
+    // stays valid, and every chunk of a load is released in one go once its last chore is dropped. A list that a
+    // setter outgrows hands its block back to the pools on top, where later allocations reuse it. wxString has no
+    // allocator hook, so only the chore objects and their symbol lists live here; vocabulary text is in the StringPool
+    class ChoreArena : public std::pmr::memory_resource {
+    private:
+        std::pmr::monotonic_buffer_resource buffer;
+        std::pmr::unsynchronized_pool_resource pools{ &buffer };
+        std::mutex mutex;               // A chore may be released on another thread than the one that built it
+        size_t allocated = 0;
+
+        void* do_allocate(size_t bytes, size_t alignment) override {
+            std::lock_guard<std::mutex> lock(mutex);
+            allocated += bytes;
+            return pools.allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* pointer, size_t bytes, size_t alignment) override {
+            std::lock_guard<std::mutex> lock(mutex);
+            allocated -= bytes;
+            pools.deallocate(pointer, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+
+    public:
+        static constexpr size_t INITIAL_BLOCK_BYTES = 64 * 1024;
+
+        ChoreArena() : buffer(INITIAL_BLOCK_BYTES) {}
+
+        size_t bytesAllocated() {
+            std::lock_guard<std::mutex> lock(mutex);
+            return allocated;
+        }
+    };
+
+    // Allocator for std::allocate_shared that holds a reference to its arena
+    template<typename T>
+    struct ArenaAllocator {
+        using value_type = T;
+        shared_ptr<ChoreArena> arena;
+
+        explicit ArenaAllocator(shared_ptr<ChoreArena> arena) : arena(std::move(arena)) {}
+
+        template<typename U>
+        ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena) {}
+
+        T* allocate(size_t count) {
+            return static_cast<T*>(arena->allocate(count * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T* pointer, size_t count) {
+            arena->deallocate(pointer, count * sizeof(T), alignof(T));
+        }
+
+        template<typename U>
+        bool operator==(const ArenaAllocator<U>& other) const {
+            return arena == other.arena;
+        }
+
+        template<typename U>
+        bool operator!=(const ArenaAllocator<U>& other) const {
+            return arena != other.arena;
+        }
+    };
+
+    // Chore fields in the order of Chore::toJSON, as named by CSV columns and snapshot keys
+    inline const vector<std::string>& choreFieldNames() {
+        static const vector<std::string> names = { "id", "name", "description", "frequency", "estimated_time", "earnings",
+            "days", "location", "tools_required", "materials_needed", "notes", "tags", "difficulty", "priority", "status" };
+        return names;
+    }
+
+    // Keys of a chore record some Chore class reads: the common fields and the details of each difficulty
+    inline bool isKnownChoreKey(const std::string& key) {
+        static const std::unordered_set<std::string> known = []() {
+            std::unordered_set<std::string> keys(choreFieldNames().begin(), choreFieldNames().end());
+            keys.insert({ "multitasking_tips", "variations", "subtasks" });
+            return keys;
+        }();
+        return known.count(key) > 0;
+    }
+
     //********************************************************************************************************************
     // Chore class modified to work with JSON and wxWidgets functions
     class Chore {
@@ -209,18 +568,25 @@ namespace ChoreAppNamespace {
         // wxString for GUI compatibility
         wxString name;
         wxString description;
-        wxString frequency;
-        wxString estimated_time;
         wxString notes;
-        wxString location;
 
-        // Vector of wxString for GUI compatibility
-        vector<wxString> tags;
-        vector<wxString> tools_required;
-        vector<wxString> materials_needed;
-        vector<wxString> days;
+        // Values from small vocabularies, interned in StringPool::global()
+        Symbol frequency = StringPool::EMPTY;
+        Symbol estimated_time = StringPool::EMPTY;
+        Symbol location = StringPool::EMPTY;
+        SymbolList tags;
+        SymbolList tools_required;
+        SymbolList materials_needed;
+        DayMask days = NO_DAYS;
+        SymbolList otherDays;   // Entries of "days" that name no weekday, such as "Daily", kept as written
+        json extraFields;   // Keys of the record this version does not read, written back unchanged
         // Adding callback function for status change
-        function<void()> onUpdate;
+        function<void(CHANGE)> onUpdate;
+        // Unsaved bit read by incremental saves, and the cached serialized form with its own validity bit
+        bool dirty = true;
+        bool fragmentStale = true;
+        std::shared_ptr<const std::string> cachedFragment;  // Shared with snapshots still being written
+        SNAPSHOT_FORMAT cachedFormat = SNAPSHOT_FORMAT::JSON;
 
         // Enumerations for difficulty, status, and priority
         DIFFICULTY difficulty;
@@ -228,49 +594,188 @@ namespace ChoreAppNamespace {
         PRIORITY priority;
 
     public:
+        // Field of a record, or null when the record does not have it (the const operator[] requires the key)
+        static const json& fieldOf(const json& j, const char* key) {
+            static const json missing;
+            auto it = j.find(key);
+            return it == j.end() ? missing : *it;
+        }
+
         // Constructor to initialize the Chore object
-        Chore(const json& j, std::function<void()> callback = nullptr) : onUpdate(callback) {
-            id = j["id"].is_null() ? -1 : j["id"].get<int>();
-            name = j["name"].is_null() ? wxString("") : wxString(j["name"].get<std::string>());
-            description = j["description"].is_null() ? wxString("") : wxString(j["description"].get<std::string>());
-            frequency = j["frequency"].is_null() ? wxString("") : wxString(j["frequency"].get<std::string>());
-            estimated_time = j["estimated_time"].is_null() ? wxString("") : wxString(j["estimated_time"].get<std::string>());
-            earnings = j["earnings"].is_null() ? 0 : j["earnings"].get<int>();
-
-            days = j["days"].is_null() ? vector<wxString>() : parseVectorWXString(j["days"]);
-            location = j["location"].is_null() ? wxString("") : wxString(j["location"].get<std::string>());
-            tools_required = j["tools_required"].is_null() ? vector<wxString>() : parseVectorWXString(j["tools_required"]);
-            materials_needed = j["materials_needed"].is_null() ? vector<wxString>() : parseVectorWXString(j["materials_needed"]);
-            notes = j["notes"].is_null() ? wxString("") : wxString(j["notes"].get<std::string>());
-            tags = j["tags"].is_null() ? vector<wxString>() : parseVectorWXString(j["tags"]);
+        Chore(const json& j, std::function<void(CHANGE)> callback = nullptr) : onUpdate(callback) {
+            id = fieldOf(j, "id").is_null() ? -1 : fieldOf(j, "id").get<int>();
+            name = fieldOf(j, "name").is_null() ? wxString("") : wxString(fieldOf(j, "name").get<std::string>());
+            description = fieldOf(j, "description").is_null() ? wxString("") : wxString(fieldOf(j, "description").get<std::string>());
+            frequency = fieldOf(j, "frequency").is_null() ? StringPool::EMPTY : intern(fieldOf(j, "frequency").get<std::string>());
+            estimated_time = fieldOf(j, "estimated_time").is_null() ? StringPool::EMPTY : intern(fieldOf(j, "estimated_time").get<std::string>());
+            earnings = fieldOf(j, "earnings").is_null() ? 0 : fieldOf(j, "earnings").get<int>();
+
+            readDays(fieldOf(j, "days"));
+            location = fieldOf(j, "location").is_null() ? StringPool::EMPTY : intern(fieldOf(j, "location").get<std::string>());
+            parseSymbols(fieldOf(j, "tools_required"), tools_required);
+            parseSymbols(fieldOf(j, "materials_needed"), materials_needed);
+            notes = fieldOf(j, "notes").is_null() ? wxString("") : wxString(fieldOf(j, "notes").get<std::string>());
+            parseSymbols(fieldOf(j, "tags"), tags);
             difficulty = parseDifficulty(j);
             priority = parsePriority(j);
             status = parseStatus(j);
+            readExtraFields(j);
         }
 
 
         // Default constructor
         Chore() = default;
 
+        // Empty chore whose lists allocate from resource
+        explicit Chore(std::pmr::memory_resource* resource) : tags(resource), tools_required(resource), materials_needed(resource), otherDays(resource) {}
+
+        // Empty chore of the class for difficulty (EasyChore, MediumChore or HardChore), allocated in arena or
+        // on the heap without one; defined after those classes
+        static shared_ptr<Chore> create(DIFFICULTY difficulty, const shared_ptr<ChoreArena>& arena = nullptr);
+
+        // Chore of the class named by the record's "difficulty", tolerating missing or null fields
+        static shared_ptr<Chore> fromJSON(const json& j, const shared_ptr<ChoreArena>& arena = nullptr);
+
+        // Build a chore from a record of the current schema, where every field is present with its type.
+        // One handler covers the whole record instead of a null check per field; a record that does not
+        // match returns nullptr so the caller can fall back to the tolerant json constructor
+        static shared_ptr<Chore> fromCurrentSchema(const json& j, const shared_ptr<ChoreArena>& arena = nullptr) {
+            try {
+                const std::string& difficulty = j.at("difficulty").get_ref<const std::string&>();
+                auto chore = create(difficulty == "medium" ? DIFFICULTY::MEDIUM : difficulty == "hard" ? DIFFICULTY::HARD : DIFFICULTY::EASY, arena);
+                chore->id = j.at("id").get<int>();
+                chore->name = wxString(j.at("name").get_ref<const std::string&>());
+                chore->description = wxString(j.at("description").get_ref<const std::string&>());
+                chore->frequency = intern(j.at("frequency").get_ref<const std::string&>());
+                chore->estimated_time = intern(j.at("estimated_time").get_ref<const std::string&>());
+                chore->earnings = j.at("earnings").get<int>();
+                chore->location = intern(j.at("location").get_ref<const std::string&>());
+                chore->notes = wxString(j.at("notes").get_ref<const std::string&>());
+                for (const auto& item : j.at("days")) chore->addDay(item.get_ref<const std::string&>());
+                for (const auto& item : j.at("tools_required")) chore->tools_required.push_back(intern(item.get_ref<const std::string&>()));
+                for (const auto& item : j.at("materials_needed")) chore->materials_needed.push_back(intern(item.get_ref<const std::string&>()));
+                for (const auto& item : j.at("tags")) chore->tags.push_back(intern(item.get_ref<const std::string&>()));
+                const std::string& priority = j.at("priority").get_ref<const std::string&>();
+                const std::string& status = j.at("status").get_ref<const std::string&>();
+                chore->difficulty = difficulty == "medium" ? DIFFICULTY::MEDIUM : difficulty == "hard" ? DIFFICULTY::HARD : DIFFICULTY::EASY;
+                chore->readDetails(j);
+                chore->priority = priority == "moderate" ? PRIORITY::MODERATE : priority == "high" ? PRIORITY::HIGH : PRIORITY::LOW;
+                chore->status = status == "in_progress" ? STATUS::IN_PROGRESS : status == "completed" ? STATUS::COMPLETED : STATUS::NOT_STARTED;
+                if (j.size() > choreFieldNames().size()) {
+                    chore->readExtraFields(j);  // Only a record with more than the common fields can have any
+                }
+                return chore;
+            }
+            catch (const json::exception&) {
+                return nullptr;
+            }
+        }
+
         virtual ~Chore() {}
 
-        // Helper function to parse a vector of wxString from JSON
-        vector<wxString> parseVectorWXString(const json& j) {
-            vector<wxString> result;
+        // Read the fields only some difficulties have (multitasking_tips, variations, subtasks) from a chore record
+        virtual void readDetails(const json&) {}
+
+        // Keep the keys of a record that no Chore class reads, so saving the chore writes them back
+        void readExtraFields(const json& j) {
+            extraFields = nullptr;
+            for (const auto& [key, value] : j.items()) {
+                if (!isKnownChoreKey(key)) {
+                    extraFields[key] = value;
+                }
+            }
+        }
+
+        // Copy other into this chore if both are of the same class; false leaves this chore unchanged
+        virtual bool assign(const Chore& other) {
+            if (typeid(*this) != typeid(other)) {
+                return false;
+            }
+            *this = other;
+            return true;
+        }
+
+        // Helper function to intern a JSON array of strings
+        static void parseSymbols(const json& j, SymbolList& result) {
+            result.clear();
             if (!j.is_null() && j.is_array()) {
                 for (const auto& item : j) {
-                    result.push_back(wxString(item.get<std::string>()));
+                    result.push_back(intern(item.get<std::string>()));
+                }
+            }
+        }
+
+        void readDays(const json& j) {
+            days = NO_DAYS;
+            otherDays.clear();
+            if (j.is_array()) {
+                for (const auto& item : j) {
+                    addDay(item.get<std::string>());
+                }
+            }
+        }
+
+        // The weekdays, Monday first, then the other entries in the order they were read
+        json daysToJSON() const {
+            json result = json::array();
+            for (size_t day = 0; day < WEEKDAY_COUNT; day++) {
+                if (days & dayBit(static_cast<WEEKDAY>(day))) {
+                    result.push_back(weekdayName(static_cast<WEEKDAY>(day)));
                 }
             }
+            for (Symbol symbol : otherDays) {
+                result.push_back(symbolText(symbol));
+            }
+            return result;
+        }
+
+        static json symbolsToJSON(const SymbolList& symbols) {
+            json result = json::array();
+            for (Symbol symbol : symbols) {
+                result.push_back(symbolText(symbol));
+            }
             return result;
         }
 
 
         // Call this function to trigger GUI updates
-        void triggerUpdate() {
+        void triggerUpdate(CHANGE change = CHANGE::FIELDS) {
+            dirty = true;
+            fragmentStale = true;
             if (onUpdate) {
-                onUpdate();
+                onUpdate(change);
+            }
+        }
+
+        // True until the chore has been persisted since its last change
+        bool isDirty() const {
+            return dirty;
+        }
+
+        // The file (or a write already handed to the writer) holds the chore's current state
+        void markSaved() {
+            dirty = false;
+        }
+
+        // Serialized form of this chore, re-encoded only when it changed or the format differs;
+        // this never touches the unsaved bit, so callers that persist the fragment call markSaved()
+        const std::string& getSerialized(SNAPSHOT_FORMAT format) {
+            return *getSerializedFragment(format);
+        }
+
+        // The cached fragment itself, which stays unchanged while a snapshot writer holds it
+        std::shared_ptr<const std::string> getSerializedFragment(SNAPSHOT_FORMAT format) {
+            if (fragmentStale || !cachedFragment || cachedFormat != format) {
+                cachedFragment = std::make_shared<const std::string>(serializeChoreFragment(toJSON(), format));
+                cachedFormat = format;
+                fragmentStale = false;
             }
+            return cachedFragment;
+        }
+
+        // Replace the update callback (used by ChoreManager to journal changes)
+        void setUpdateCallback(std::function<void(CHANGE)> callback) {
+            onUpdate = callback;
         }
         // startChore method using wxTextEntryDialog instead of standard input
         void virtual startChore(wxWindow* parent) {
@@ -287,7 +792,7 @@ namespace ChoreAppNamespace {
                 status = STATUS::IN_PROGRESS;
             }
             wxMessageBox(message, "Chore Status", wxOK | wxICON_INFORMATION, parent);
-            triggerUpdate();  // Trigger any GUI updates if linked
+            triggerUpdate(CHANGE::STATUS);  // Trigger any GUI updates if linked
         }
 
         // completeChore method using wxTextEntryDialog instead of standard input
@@ -304,7 +809,7 @@ namespace ChoreAppNamespace {
                 message = "Chore already completed: " + wxString(name);
             }
             wxMessageBox(message, "Chore Completion", wxOK | wxICON_INFORMATION, parent);
-            triggerUpdate();  // Trigger any GUI updates if linked
+            triggerUpdate(CHANGE::STATUS);  // Trigger any GUI updates if linked
         }
 
         // resetChore method using wxTextEntryDialog instead of standard input
@@ -318,38 +823,42 @@ namespace ChoreAppNamespace {
                 status = STATUS::NOT_STARTED;
             }
             wxMessageBox(message, "Chore Reset", wxOK | wxICON_INFORMATION, parent);
-            triggerUpdate();  // Trigger any GUI updates if linked
+            triggerUpdate(CHANGE::STATUS);  // Trigger any GUI updates if linked
         }
         // toJson method to serialize the Chore class object into a JSON format
         virtual json toJSON() const {
-            return json{
+            json j = {
                 {"id", id},
                 {"name", name},
                 {"description", description},
-                {"frequency", frequency},
-                {"estimated_time", estimated_time},
+                {"frequency", symbolText(frequency)},
+                {"estimated_time", symbolText(estimated_time)},
                 {"earnings", earnings},
-                {"days", days},
-                {"location", location},
-                {"tools_required", tools_required},
-                {"materials_needed", materials_needed},
+                {"days", daysToJSON()},
+                {"location", symbolText(location)},
+                {"tools_required", symbolsToJSON(tools_required)},
+                {"materials_needed", symbolsToJSON(materials_needed)},
                 {"notes", notes},
-                {"tags", tags},
+                {"tags", symbolsToJSON(tags)},
                 {"difficulty", toStringD(difficulty)},
                 {"priority", toStringP(priority)},
                 {"status", toStringS(status)}
             };
+            for (const auto& [key, value] : extraFields.items()) {
+                j.emplace(key, value);
+            }
+            return j;
         }
         // prettyPrint method to display the Chore class object in a readable format
         wxString PrettyPrintClassAttributes() const {
             wxString result = "Chore ID: " + to_string(id) + "\n"
                 + "Name: " + name.ToStdString() + "\n"  // Convert wxString to std::string
                 + "Description: " + description.ToStdString() + "\n"  // Convert wxString to std::string
-                + "Frequency: " + frequency.ToStdString() + "\n"  // Convert wxString to std::string
-                + "Estimated Time: " + estimated_time.ToStdString() + "\n"  // Convert wxString to std::string
+                + "Frequency: " + symbolText(frequency).ToStdString() + "\n"  // Convert wxString to std::string
+                + "Estimated Time: " + symbolText(estimated_time).ToStdString() + "\n"  // Convert wxString to std::string
                 + "Earnings: " + std::to_string(earnings) + "\n"
-                + "Days: " + formatVector(days) + "\n"  // Ensure formatVector returns std::string
-                + "Location: " + location.ToStdString() + "\n"  // Convert wxString to std::string
+                + "Days: " + formatVector(getDays()) + "\n"  // Ensure formatVector returns std::string
+                + "Location: " + symbolText(location).ToStdString() + "\n"  // Convert wxString to std::string
                 + "Tools Required: " + formatVector(tools_required) + "\n"  // Ensure formatVector returns std::string
                 + "Materials Needed: " + formatVector(materials_needed) + "\n"  // Ensure formatVector returns std::string
                 + "Notes: " + notes.ToStdString() + "\n"  // Convert wxString to std::string
@@ -407,20 +916,28 @@ namespace ChoreAppNamespace {
         }
 
         wxString getFrequency() const {
+            return symbolText(frequency);
+        }
+
+        Symbol getFrequencySymbol() const {
             return frequency;
         }
 
         void setFrequency(const wxString& newFrequency) {
-            frequency = newFrequency;
+            frequency = intern(newFrequency);
             triggerUpdate();
         }
 
         wxString getEstimatedTime() const {
+            return symbolText(estimated_time);
+        }
+
+        Symbol getEstimatedTimeSymbol() const {
             return estimated_time;
         }
 
         void setEstimatedTime(const wxString& newTime) {
-            estimated_time = newTime;
+            estimated_time = intern(newTime);
             triggerUpdate();
         }
 
@@ -434,38 +951,86 @@ namespace ChoreAppNamespace {
         }
 
         vector<wxString> getDays() const {
+            vector<wxString> names = dayMaskNames(days);
+            for (Symbol symbol : otherDays) {
+                names.push_back(symbolText(symbol));
+            }
+            return names;
+        }
+
+        // Add one entry of a "days" list: a weekday sets its bit, anything else is kept as written
+        void addDay(const std::string& name) {
+            if (DayMask bit = dayMaskFromName(name)) {
+                days |= bit;
+            }
+            else {
+                otherDays.push_back(intern(name));
+            }
+        }
+
+        DayMask getDayMask() const {
             return days;
         }
 
+        bool isDueOn(WEEKDAY day) const {
+            return (days & dayBit(day)) != 0;
+        }
+
+        bool isDueOnAny(DayMask mask) const {
+            return (days & mask) != 0;
+        }
+
+        // Names other than the seven weekdays are kept as written but match no day
         void setDays(const vector<wxString>& newDays) {
-            days = newDays;
+            days = NO_DAYS;
+            otherDays.clear();
+            for (const auto& name : newDays) {
+                addDay(name.ToStdString());
+            }
+            triggerUpdate();
+        }
+
+        void setDayMask(DayMask newDays) {
+            days = newDays & ALL_DAYS;
             triggerUpdate();
         }
 
         wxString getLocation() const {
+            return symbolText(location);
+        }
+
+        Symbol getLocationSymbol() const {
             return location;
         }
 
         void setLocation(const wxString& newLocation) {
-            location = newLocation;
+            location = intern(newLocation);
             triggerUpdate();
         }
 
         vector<wxString> getToolsRequired() const {
+            return symbolTexts(tools_required);
+        }
+
+        const SymbolList& getToolSymbols() const {
             return tools_required;
         }
 
         void setToolsRequired(const vector<wxString>& newTools) {
-            tools_required = newTools;
+            internAll(newTools, tools_required);
             triggerUpdate();
         }
 
         vector<wxString> getMaterialsNeeded() const {
+            return symbolTexts(materials_needed);
+        }
+
+        const SymbolList& getMaterialSymbols() const {
             return materials_needed;
         }
 
         void setMaterialsNeeded(const vector<wxString>& newMaterials) {
-            materials_needed = newMaterials;
+            internAll(newMaterials, materials_needed);
             triggerUpdate();
         }
 
@@ -479,11 +1044,19 @@ namespace ChoreAppNamespace {
         }
 
         vector<wxString> getTags() const {
+            return symbolTexts(tags);
+        }
+
+        const SymbolList& getTagSymbols() const {
             return tags;
         }
 
+        bool hasTag(Symbol tag) const {
+            return std::find(tags.begin(), tags.end(), tag) != tags.end();
+        }
+
         void setTags(const vector<wxString>& newTags) {
-            tags = newTags;
+            internAll(newTags, tags);
             triggerUpdate();
         }
 
@@ -496,12 +1069,34 @@ namespace ChoreAppNamespace {
             triggerUpdate();
         }
 
+        PRIORITY getPriority() const {
+            return priority;
+        }
+
+        void setPriority(PRIORITY newPriority) {
+            priority = newPriority;
+            triggerUpdate();
+        }
+
         STATUS getStatus() const {
             return status;
         }
 
+        wxString getStatusString() const {
+            return toStringS(status);
+        }
+
+        // Apply a status read from a JSON record such as {"status": "completed"}
+        void setStatusFromJSON(const json& j) {
+            status = parseStatus(j);
+            triggerUpdate(CHANGE::STATUS);
+        }
+
         // Friend declaration for operator<<
         friend ostream& operator<<(ostream& os, const Chore& chore);
+        // The streaming loader fills chore fields directly from parse events
+        friend class ChoreSaxLoader;
+        friend class ChoreImporter;
 
         // Operator overloading for equality comparison
         virtual bool operator==(const Chore& other) const {
@@ -550,6 +1145,10 @@ namespace ChoreAppNamespace {
         }
     protected:
         // Helper function to format a vector of strings for display
+        static wxString formatVector(const SymbolList& symbols) {
+            return formatVector(symbolTexts(symbols));
+        }
+
         static wxString formatVector(const vector<wxString>& vec) {
             wxString result;
             for (const auto& item : vec) {
@@ -560,7 +1159,7 @@ namespace ChoreAppNamespace {
         }
 
         // Exception handling in JSON parsing
-        DIFFICULTY parseDifficulty(const json& j) {
+        static DIFFICULTY parseDifficulty(const json& j) {
             try {
                 if (j.contains("difficulty") && !j["difficulty"].is_null()) {
                     wxString dif = j["difficulty"].get<wxString>();
@@ -645,18 +1244,33 @@ namespace ChoreAppNamespace {
     };
     //************************
     //CLASS EASY CHORE DEFINITION
-    class EasyChore : public Chore {
+    class EasyChore final : public Chore {
     private:
         string multitasking_tips;
 
     public:
+        explicit EasyChore(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) : Chore(resource) {}
+
         EasyChore(const json& j) : Chore(j)
         {
-            multitasking_tips = j["multitasking_tips"];
+            readDetails(j);
+        }
+
+        void readDetails(const json& j) override {
+            auto tips = j.find("multitasking_tips");
+            multitasking_tips = tips != j.end() && tips->is_string() ? tips->get<string>() : string();
+        }
+
+        bool assign(const Chore& other) override {
+            if (typeid(other) != typeid(EasyChore)) {
+                return false;
+            }
+            *this = static_cast<const EasyChore&>(other);
+            return true;
         }
         void startChore(wxWindow* parent) override
         {
-            &Chore::startChore;
+            Chore::startChore(parent);
             wxMessageBox("Completing Easy Chore", "EASY CHORE", wxOK | wxICON_INFORMATION, parent);
 
         }
@@ -697,7 +1311,7 @@ namespace ChoreAppNamespace {
         json toJSON() const override
         {
             json j = Chore::toJSON();
-            j += json{ "multitasking_tips",multitasking_tips };
+            j["multitasking_tips"] = multitasking_tips;
             return j;
         }
 
@@ -705,16 +1319,30 @@ namespace ChoreAppNamespace {
     };
     //***********************************
     // MEDIUM CHORE DECLARATION
-    class MediumChore : public Chore {
+    class MediumChore final : public Chore {
     private:
         vector<string> variations;
 
     public:
+        explicit MediumChore(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) : Chore(resource) {}
 
         MediumChore(const json& j) : Chore(j)
         {
+            readDetails(j);
+        }
+
+        void readDetails(const json& j) override {
             // Directly parse the JSON array to the vector of strings
-            variations = j["variations"].is_null() ? vector<string>() : j["variations"].get<vector<string>>();
+            auto found = j.find("variations");
+            variations = found != j.end() && found->is_array() ? found->get<vector<string>>() : vector<string>();
+        }
+
+        bool assign(const Chore& other) override {
+            if (typeid(other) != typeid(MediumChore)) {
+                return false;
+            }
+            *this = static_cast<const MediumChore&>(other);
+            return true;
         }
 
         //void startChore()override {
@@ -758,7 +1386,7 @@ namespace ChoreAppNamespace {
         json toJSON() const override
         {
             json j = Chore::toJSON();
-            j += json{ "variations", variations };
+            j["variations"] = variations;
             return j;
         }
 
@@ -766,7 +1394,7 @@ namespace ChoreAppNamespace {
     };
     //*******************************
     //HARD CHORE DEFINITION
-    class HardChore : public Chore {
+    class HardChore final : public Chore {
     private:
         struct Subtask {
             string name;
@@ -774,9 +1402,9 @@ namespace ChoreAppNamespace {
             int earnings;
 
             Subtask(const json& subtaskJson) :
-                name(subtaskJson["name"].is_null() ? "" : subtaskJson["name"].get<string>()),
-                estimated_time(subtaskJson["estimated_time"].is_null() ? "" : subtaskJson["estimated_time"].get<string>()),
-                earnings(subtaskJson["earnings"].is_null() ? 0 : subtaskJson["earnings"].get<int>()) {}
+                name(fieldOf(subtaskJson, "name").is_null() ? "" : fieldOf(subtaskJson, "name").get<string>()),
+                estimated_time(fieldOf(subtaskJson, "estimated_time").is_null() ? "" : fieldOf(subtaskJson, "estimated_time").get<string>()),
+                earnings(fieldOf(subtaskJson, "earnings").is_null() ? 0 : fieldOf(subtaskJson, "earnings").get<int>()) {}
 
             // Add equality comparison operator for subtasks
             bool operator==(const Subtask& other) const {
@@ -791,14 +1419,32 @@ namespace ChoreAppNamespace {
 
     public:
 
+        explicit HardChore(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) : Chore(resource) {}
+
         HardChore(const json& j) : Chore(j) {
-            if (!j["subtasks"].is_null() && j["subtasks"].is_array()) {
-                for (const auto& subtaskJson : j["subtasks"]) {
-                    subtasks.push_back(Subtask(subtaskJson));
+            readDetails(j);
+        }
+
+        void readDetails(const json& j) override {
+            subtasks.clear();
+            auto found = j.find("subtasks");
+            if (found != j.end() && found->is_array()) {
+                for (const auto& subtaskJson : *found) {
+                    if (subtaskJson.is_object()) {
+                        subtasks.push_back(Subtask(subtaskJson));
+                    }
                 }
             }
         }
 
+        bool assign(const Chore& other) override {
+            if (typeid(other) != typeid(HardChore)) {
+                return false;
+            }
+            *this = static_cast<const HardChore&>(other);
+            return true;
+        }
+
         //void startChore() override {
         //    cout << "Starting hard chore: " << endl;
         //    Chore::startChore();
@@ -864,24 +1510,121 @@ namespace ChoreAppNamespace {
             return j;
         }
     };
+
     //*************************************************************************************************************************
-    // CREATE CONTAINER CLASS
+    // Chore factory: the class of a chore follows its difficulty, so loading keeps the fields of each kind
     template<typename T>
-    class Container {
+    shared_ptr<Chore> allocateChore(const shared_ptr<ChoreArena>& arena) {
+        if (!arena) {
+            return std::make_shared<T>();
+        }
+        return std::allocate_shared<T>(ArenaAllocator<T>(arena), arena.get());
+    }
+
+    inline shared_ptr<Chore> Chore::create(DIFFICULTY difficulty, const shared_ptr<ChoreArena>& arena) {
+        switch (difficulty) {
+        case DIFFICULTY::MEDIUM: return allocateChore<MediumChore>(arena);
+        case DIFFICULTY::HARD: return allocateChore<HardChore>(arena);
+        default: return allocateChore<EasyChore>(arena);
+        }
+    }
+
+    inline shared_ptr<Chore> Chore::fromJSON(const json& j, const shared_ptr<ChoreArena>& arena) {
+        switch (parseDifficulty(j)) {
+        case DIFFICULTY::MEDIUM: return arena ? std::allocate_shared<MediumChore>(ArenaAllocator<MediumChore>(arena), j) : std::make_shared<MediumChore>(j);
+        case DIFFICULTY::HARD: return arena ? std::allocate_shared<HardChore>(ArenaAllocator<HardChore>(arena), j) : std::make_shared<HardChore>(j);
+        default: return arena ? std::allocate_shared<EasyChore>(ArenaAllocator<EasyChore>(arena), j) : std::make_shared<EasyChore>(j);
+        }
+    }
+
+    //*************************************************************************************************************************
+    // ChoreArray keeps chores by value in one contiguous vector of variants, one alternative per difficulty. Loops
+    // over it reach each chore without a pointer to chase, and std::visit calls the members of the concrete (final)
+    // class directly instead of through the vtable. The elements are copies: they are detached from ChoreManager,
+    // which keeps its shared chores for editing, so an array is a read-only view rebuilt when the data changes
+    using ChoreVariant = std::variant<EasyChore, MediumChore, HardChore>;
+
+    class ChoreArray {
     private:
-        vector<shared_ptr<T>> items;
+        vector<ChoreVariant> items;
 
     public:
+        void clear() {
+            items.clear();
+        }
 
-        // Generic bubble sort using comparator
-        template<typename Comparator>
-        void sortItems(Comparator comp, bool ascending = true) {
-            try
-            {
-                bool swapped;
-                do {
-                    swapped = false;
-                    for (size_t i = 1; i < items.size(); i++) {
+        void reserve(size_t count) {
+            items.reserve(count);
+        }
+
+        size_t size() const {
+            return items.size();
+        }
+
+        // Append a copy of chore as the alternative of its class; a plain Chore is rebuilt by difficulty
+        void push_back(const Chore& chore) {
+            if (auto easy = dynamic_cast<const EasyChore*>(&chore)) {
+                items.emplace_back(std::in_place_type<EasyChore>, *easy);
+            }
+            else if (auto medium = dynamic_cast<const MediumChore*>(&chore)) {
+                items.emplace_back(std::in_place_type<MediumChore>, *medium);
+            }
+            else if (auto hard = dynamic_cast<const HardChore*>(&chore)) {
+                items.emplace_back(std::in_place_type<HardChore>, *hard);
+            }
+            else {
+                json record = chore.toJSON();
+                switch (chore.getDifficulty()) {
+                case DIFFICULTY::MEDIUM: items.emplace_back(std::in_place_type<MediumChore>, record); break;
+                case DIFFICULTY::HARD: items.emplace_back(std::in_place_type<HardChore>, record); break;
+                default: items.emplace_back(std::in_place_type<EasyChore>, record); break;
+                }
+            }
+            // Changes to a copy must not reach the manager as changes of the original
+            std::visit([](Chore& copy) { copy.setUpdateCallback(nullptr); }, items.back());
+        }
+
+        const ChoreVariant& operator[](size_t index) const {
+            return items[index];
+        }
+
+        // The chore at index as its base class
+        const Chore& at(size_t index) const {
+            return std::visit([](const Chore& chore) -> const Chore& { return chore; }, items[index]);
+        }
+
+        // Call visit with every chore as its concrete class
+        template<typename Visitor>
+        void forEach(Visitor&& visit) const {
+            for (const auto& item : items) {
+                std::visit(visit, item);
+            }
+        }
+
+        long long totalEarnings() const {
+            long long total = 0;
+            forEach([&total](const auto& chore) { total += chore.getEarnings(); });
+            return total;
+        }
+    };
+    //*************************************************************************************************************************
+    // CREATE CONTAINER CLASS
+    template<typename T>
+    class Container {
+    private:
+        vector<shared_ptr<T>> items;
+
+    public:
+
+        // Generic bubble sort using comparator
+        template<typename Comparator>
+        void sortItems(Comparator comp, bool ascending = true) {
+            try
+            {
+                bool swapped;
+                do {
+                    swapped = false;
+                    for (size_t i = 1; i < items.size(); i++) {
                         if ((ascending && comp(items[i - 1], items[i])) || (!ascending && comp(items[i], items[i - 1]))) {
                             swap(items[i - 1], items[i]);
                             swapped = true;
@@ -1054,174 +1797,4412 @@ namespace ChoreAppNamespace {
         }
     };
     //*********************************************************************************************************************
-    // create the ChoreManager class
-    class ChoreManager {
+    // Version of the data file layout, stamped in every snapshot under SCHEMA_KEY (which sorts before every
+    // other key, so it is the first member of the file). Files without it are version 1: chore fields may be
+    // null or missing and unknown fields may appear. Version 2 files hold every chore field with its type.
+    const int SCHEMA_VERSION = 2;
+    const std::string SCHEMA_KEY = "_schema_version";
+
+    //*********************************************************************************************************************
+    // CBOR "self-describe" tag written in front of CBOR snapshots so they can be recognized on load
+    const std::string CBOR_MAGIC = "\xD9\xD9\xF7";
+
+    // Serialize a snapshot document in the requested format
+    inline std::string serializeSnapshot(const json& snapshot, SNAPSHOT_FORMAT format) {
+        switch (format) {
+        case SNAPSHOT_FORMAT::CBOR: {
+            std::string bytes = CBOR_MAGIC;
+            json::to_cbor(snapshot, bytes);
+            return bytes;
+        }
+        case SNAPSHOT_FORMAT::MSGPACK: {
+            std::string bytes;
+            json::to_msgpack(snapshot, bytes);
+            return bytes;
+        }
+        case SNAPSHOT_FORMAT::JSON_COMPACT:
+            return snapshot.dump() + "\n";
+        default:
+            return snapshot.dump(4) + "\n";
+        }
+    }
+
+    // A zlib stream (RFC 1950) starts with 0x78 and a header whose first two bytes are a multiple of 31;
+    // no JSON, CBOR or MessagePack snapshot starts that way
+    inline bool isCompressedSnapshot(const char* data, size_t size) {
+        if (size < 2 || static_cast<unsigned char>(data[0]) != 0x78) {
+            return false;
+        }
+        return ((static_cast<unsigned char>(data[0]) << 8) | static_cast<unsigned char>(data[1])) % 31 == 0;
+    }
+
+    // zlib-compress an encoded snapshot; level is wxZ_BEST_SPEED to wxZ_BEST_COMPRESSION or wxZ_DEFAULT_COMPRESSION
+    inline std::string compressSnapshot(const std::string& payload, int level) {
+        wxMemoryOutputStream memory;
+        {
+            wxZlibOutputStream zlib(memory, level, wxZLIB_ZLIB);
+            zlib.Write(payload.data(), payload.size());
+            zlib.Close();
+        }
+        std::string bytes(static_cast<size_t>(memory.GetLength()), '\0');
+        memory.CopyTo(&bytes[0], bytes.size());
+        return bytes;
+    }
+
+    inline bool decompressSnapshot(const char* data, size_t size, std::string& out) {
+        wxMemoryInputStream memory(data, size);
+        wxZlibInputStream zlib(memory, wxZLIB_ZLIB);
+        char buffer[64 * 1024];
+        out.clear();
+        while (zlib.Read(buffer, sizeof(buffer)).LastRead() > 0) {
+            out.append(buffer, zlib.LastRead());
+        }
+        return zlib.GetLastError() == wxSTREAM_EOF || zlib.GetLastError() == wxSTREAM_NO_ERROR;
+    }
+
+    // Detect the format of a snapshot from its first bytes
+    inline SNAPSHOT_FORMAT detectSnapshotFormat(const char* data, size_t size) {
+        if (size >= CBOR_MAGIC.size() && std::equal(CBOR_MAGIC.begin(), CBOR_MAGIC.end(), data)) {
+            return SNAPSHOT_FORMAT::CBOR;
+        }
+        if (size > 0) {
+            unsigned char first = static_cast<unsigned char>(data[0]);
+            // MessagePack maps start with a fixmap (0x80-0x8f) or map16/map32 (0xde/0xdf) marker
+            if ((first >= 0x80 && first <= 0x8f) || first == 0xde || first == 0xdf) {
+                return SNAPSHOT_FORMAT::MSGPACK;
+            }
+            // CBOR maps written without the self-describe tag (0xa0-0xbf)
+            if (first >= 0xa0 && first <= 0xbf) {
+                return SNAPSHOT_FORMAT::CBOR;
+            }
+        }
+        return SNAPSHOT_FORMAT::JSON;
+    }
+
+    // Parse a snapshot held in memory, whatever its format
+    inline json parseSnapshot(const char* data, size_t size) {
+        switch (detectSnapshotFormat(data, size)) {
+        case SNAPSHOT_FORMAT::CBOR: {
+            size_t skip = (size >= CBOR_MAGIC.size() && std::equal(CBOR_MAGIC.begin(), CBOR_MAGIC.end(), data)) ? CBOR_MAGIC.size() : 0;
+            return json::from_cbor(data + skip, data + size);
+        }
+        case SNAPSHOT_FORMAT::MSGPACK:
+            return json::from_msgpack(data, data + size);
+        default:
+            return json::parse(data, data + size);
+        }
+    }
+
+    //*********************************************************************************************************************
+    // MappedFile maps a data file read-only into memory so it can be parsed from one contiguous buffer
+    // isOpen() is false for missing, empty or special files; callers then fall back to std::ifstream
+    class MappedFile {
     private:
-        json j;
-        vector<shared_ptr<Chore>> chores;
-        vector<shared_ptr<ChoreDoer>> doers;
-        wxString dynamicFile;
-        Client* client = nullptr;  // Initialize to nullptr to clearly indicate no client initially
+        const char* data = nullptr;
+        size_t size = 0;
+#ifdef __WXMSW__
+        HANDLE fileHandle = INVALID_HANDLE_VALUE;
+        HANDLE mappingHandle = nullptr;
+#endif
+
+    public:
+        explicit MappedFile(const wxString& path) {
+#ifdef __WXMSW__
+            fileHandle = ::CreateFileW(path.wc_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+            if (fileHandle == INVALID_HANDLE_VALUE) {
+                return;
+            }
+            LARGE_INTEGER fileSize;
+            if (::GetFileType(fileHandle) != FILE_TYPE_DISK || !::GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0) {
+                return;
+            }
+            mappingHandle = ::CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (!mappingHandle) {
+                return;
+            }
+            const void* view = ::MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+            if (view) {
+                data = static_cast<const char*>(view);
+                size = static_cast<size_t>(fileSize.QuadPart);
+            }
+#else
+            int fd = ::open(path.fn_str(), O_RDONLY);
+            if (fd < 0) {
+                return;
+            }
+            struct stat st;
+            if (::fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+                void* view = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                if (view != MAP_FAILED) {
+                    ::madvise(view, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+                    data = static_cast<const char*>(view);
+                    size = static_cast<size_t>(st.st_size);
+                }
+            }
+            ::close(fd);  // The mapping stays valid after the descriptor is closed
+#endif
+        }
+
+        ~MappedFile() {
+#ifdef __WXMSW__
+            if (data) {
+                ::UnmapViewOfFile(data);
+            }
+            if (mappingHandle) {
+                ::CloseHandle(mappingHandle);
+            }
+            if (fileHandle != INVALID_HANDLE_VALUE) {
+                ::CloseHandle(fileHandle);
+            }
+#else
+            if (data) {
+                ::munmap(const_cast<char*>(data), size);
+            }
+#endif
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        bool isOpen() const {
+            return data != nullptr;
+        }
+
+        const char* getData() const {
+            return data;
+        }
 
+        size_t getSize() const {
+            return size;
+        }
+    };
 
+    //*********************************************************************************************************************
+    // ChoreSaxLoader builds Chore objects straight from parser events, without a DOM of the whole file
+    // Only the small top-level sections (user_profile, user_profiles, chore_doers, ...) are kept as json
+    class ChoreSaxLoader : public nlohmann::json_sax<json> {
     public:
-        // Constructor to initialize the ChoreManager object
-        ChoreManager(const wxString& fileName) : dynamicFile(fileName) {
-            loadData();
+        using ChoreCallback = std::function<void(shared_ptr<Chore>)>;
+
+    private:
+        // Container depth of each part of the document
+        static const size_t TOP_DEPTH = 1;      // Inside the top-level object
+        static const size_t CHORES_DEPTH = 2;   // Inside the "chores" array
+        static const size_t CHORE_DEPTH = 3;    // Inside one chore object
+        static const size_t LIST_DEPTH = 4;     // Inside a string list of a chore (days, tags, ...)
+
+        ChoreCallback onChore;
+        shared_ptr<ChoreArena> arena;     // Where chores are allocated; the heap if null
+        json retained = json::object();
+        std::vector<json*> retainStack;   // Open containers of the top-level section being retained
+        std::string topKey;               // Current key of the top-level object
+        std::string retainKey;            // Current key inside a retained object
+        std::string choreKey;             // Current key inside a chore object
+        size_t depth = 0;
+        size_t skipDepth = 0;             // Non-zero while skipping a nested value of a chore
+        bool inChores = false;
+        Chore scratch;                    // Fields of the chore being read, before its class is known
+        Chore* current = nullptr;         // &scratch while inside a chore object
+        json details = json::object();    // Fields of the current chore that only some difficulties have
+        SymbolList* currentList = nullptr;
+        bool inDays = false;              // Inside the "days" list, which becomes a mask
+        size_t choreCount = 0;
+        std::string errorMessage;
+
+        bool retaining() const {
+            return !retainStack.empty();
         }
-        // Destructor to save data when the object is destroyed
-        ~ChoreManager() {
-            saveData();
+
+        static bool isDetailKey(const std::string& key) {
+            return key == "multitasking_tips" || key == "variations" || key == "subtasks";
         }
 
-        // Method to load data from the JSON file
-        void loadData() {
-            std::ifstream file(dynamicFile.ToStdString());
-            if (!file) {
-                wxMessageBox("Error opening file: " + dynamicFile, "File Error", wxOK | wxICON_ERROR);
-                j = json::object(); // Initialize an empty JSON object if file fails to open
-                return;
+        // The value of the current chore key goes into details as json: a difficulty detail, or a key no Chore
+        // class reads, which the chore keeps to write back
+        bool retainsChoreKey() const {
+            return isDetailKey(choreKey) || !isKnownChoreKey(choreKey);
+        }
+
+        // Store a value in the retained section (or chore detail) currently being built
+        json* retainValue(json value) {
+            json* parent = retaining() ? retainStack.back() : current ? &details : &retained;
+            if (parent->is_array()) {
+                parent->push_back(std::move(value));
+                return &parent->back();
             }
+            json& slot = (*parent)[retaining() ? retainKey : current ? choreKey : topKey];
+            slot = std::move(value);
+            return &slot;
+        }
 
-            try {
-                j = json::parse(file);
+        bool openRetained(json container) {
+            retainStack.push_back(retainValue(std::move(container)));
+            depth++;
+            return true;
+        }
+
+        bool closeRetained() {
+            retainStack.pop_back();
+            return true;
+        }
+
+        template<typename T>
+        bool scalar(const T& value) {
+            if (skipDepth > 0) {
+                return true;
             }
-            catch (const json::parse_error& e) {
-                wxMessageBox("JSON Parsing Error: " + wxString(e.what()), "JSON Error", wxOK | wxICON_ERROR);
-                j = json::object(); // Initialize an empty JSON object if parsing fails
+            if (retaining() || depth == TOP_DEPTH) {
+                retainValue(json(value));
             }
-            file.close();
-            // Load client from JSON
-            if (j.contains("user_profile") && !j["user_profile"].is_null()) {
-                auto userProfile = j["user_profile"];
-                wxString username = userProfile.value("username", "defaultUser");
-                wxString theme = userProfile.value("theme", "light");
-                bool notify = userProfile.value("notify", false);
-                client = new Client(username, theme, notify);
+            else if (current && depth == CHORE_DEPTH) {
+                if (retainsChoreKey()) {
+                    retainValue(json(value));
+                }
+                else {
+                    setField(value);
+                }
+            }
+            else if (current && currentList && depth == LIST_DEPTH) {
+                if constexpr (std::is_same_v<T, std::string>) {
+                    currentList->push_back(intern(value));
+                }
+            }
+            else if (current && inDays && depth == LIST_DEPTH) {
+                if constexpr (std::is_same_v<T, std::string>) {
+                    current->addDay(value);
+                }
+            }
+            return true;
+        }
+
+        // String list member of the current chore named by choreKey
+        SymbolList* listField() {
+            if (choreKey == "tags") return &current->tags;
+            if (choreKey == "tools_required") return &current->tools_required;
+            if (choreKey == "materials_needed") return &current->materials_needed;
+            return nullptr;
+        }
+
+        void setField(const std::string& value) {
+            Chore& chore = *current;
+            if (choreKey == "name") chore.name = wxString(value);
+            else if (choreKey == "description") chore.description = wxString(value);
+            else if (choreKey == "frequency") chore.frequency = intern(value);
+            else if (choreKey == "estimated_time") chore.estimated_time = intern(value);
+            else if (choreKey == "notes") chore.notes = wxString(value);
+            else if (choreKey == "location") chore.location = intern(value);
+            else if (choreKey == "difficulty") {
+                chore.difficulty = value == "medium" ? DIFFICULTY::MEDIUM : value == "hard" ? DIFFICULTY::HARD : DIFFICULTY::EASY;
+            }
+            else if (choreKey == "priority") {
+                chore.priority = value == "moderate" ? PRIORITY::MODERATE : value == "high" ? PRIORITY::HIGH : PRIORITY::LOW;
+            }
+            else if (choreKey == "status") {
+                chore.status = value == "in_progress" ? STATUS::IN_PROGRESS : value == "completed" ? STATUS::COMPLETED : STATUS::NOT_STARTED;
+            }
+        }
+
+        void setField(long long value) {
+            if (choreKey == "id") current->id = static_cast<int>(value);
+            else if (choreKey == "earnings") current->earnings = static_cast<int>(value);
+        }
+
+        void setField(unsigned long long value) {
+            setField(static_cast<long long>(value));
+        }
+
+        void setField(double value) {
+            setField(static_cast<long long>(value));
+        }
+
+        // null and boolean fields keep their defaults, like the json constructor of Chore
+        void setField(std::nullptr_t) {}
+        void setField(bool) {}
+        void setField(const binary_t&) {}
+
+    public:
+        ChoreSaxLoader(ChoreCallback onChore, shared_ptr<ChoreArena> arena = nullptr) : onChore(onChore), arena(std::move(arena)) {}
+
+        // Top-level sections other than "chores"
+        json& getRetained() {
+            return retained;
+        }
+
+        size_t getChoreCount() const {
+            return choreCount;
+        }
+
+        const std::string& getError() const {
+            return errorMessage;
+        }
+
+        bool null() override { return scalar(nullptr); }
+        bool boolean(bool val) override { return scalar(val); }
+        bool number_integer(number_integer_t val) override { return scalar(static_cast<long long>(val)); }
+        bool number_unsigned(number_unsigned_t val) override { return scalar(static_cast<unsigned long long>(val)); }
+        bool number_float(number_float_t val, const string_t&) override { return scalar(static_cast<double>(val)); }
+        bool string(string_t& val) override { return scalar(val); }
+        bool binary(binary_t& val) override { return scalar(val); }
+
+        bool start_object(std::size_t) override {
+            if (skipDepth > 0) {
+                skipDepth++;
+            }
+            else if (retaining() || depth == TOP_DEPTH) {
+                return openRetained(json::object());
+            }
+            else if (inChores && depth == CHORES_DEPTH) {
+                // Same defaults as the json constructor of Chore uses for missing fields
+                scratch = Chore();
+                current = &scratch;
+                details = json::object();
+                current->id = -1;
+                current->earnings = 0;
+                current->difficulty = DIFFICULTY::EASY;
+                current->priority = PRIORITY::LOW;
+                current->status = STATUS::NOT_STARTED;
+            }
+            else if (current && depth == CHORE_DEPTH && retainsChoreKey()) {
+                return openRetained(json::object());
+            }
+            else if (current) {
+                skipDepth = 1;  // Nested objects are not part of Chore
+            }
+            depth++;
+            return true;
+        }
+
+        bool key(string_t& val) override {
+            if (skipDepth > 0) {
+                return true;
+            }
+            if (retaining()) {
+                retainKey = val;
+            }
+            else if (depth == TOP_DEPTH) {
+                topKey = val;
+            }
+            else if (current && depth == CHORE_DEPTH) {
+                choreKey = val;
+            }
+            return true;
+        }
+
+        bool end_object() override {
+            depth--;
+            if (skipDepth > 0) {
+                skipDepth--;
+            }
+            else if (retaining()) {
+                return closeRetained();
+            }
+            else if (current && depth == CHORES_DEPTH) {
+                // Now that its difficulty is known, the chore is built as its class
+                shared_ptr<Chore> chore = Chore::create(scratch.difficulty, arena);
+                *chore = scratch;
+                chore->readDetails(details);
+                chore->readExtraFields(details);
+                current = nullptr;
+                onChore(chore);
+                choreCount++;
+            }
+            return true;
+        }
+
+        bool start_array(std::size_t) override {
+            if (skipDepth > 0) {
+                skipDepth++;
+            }
+            else if (retaining()) {
+                return openRetained(json::array());
+            }
+            else if (depth == TOP_DEPTH) {
+                if (topKey != "chores") {
+                    return openRetained(json::array());
+                }
+                inChores = true;
+            }
+            else if (current && depth == CHORE_DEPTH && retainsChoreKey()) {
+                return openRetained(json::array());  // variations, subtasks, kept unknown lists
+            }
+            else if (current && depth == CHORE_DEPTH) {
+                currentList = listField();
+                inDays = choreKey == "days";
+                if (!currentList && !inDays) {
+                    skipDepth = 1;  // Arrays Chore knows nothing about
+                }
+            }
+            else if (current) {
+                skipDepth = 1;
+            }
+            depth++;
+            return true;
+        }
+
+        bool end_array() override {
+            depth--;
+            if (skipDepth > 0) {
+                skipDepth--;
+            }
+            else if (retaining()) {
+                return closeRetained();
+            }
+            else if ((currentList || inDays) && depth == CHORE_DEPTH) {
+                currentList = nullptr;
+                inDays = false;
+            }
+            else if (inChores && depth == TOP_DEPTH) {
+                inChores = false;
+            }
+            return true;
+        }
+
+        bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& ex) override {
+            errorMessage = ex.what();
+            return false;
+        }
+    };
+
+    // Stream a snapshot held in memory through a SAX handler, whatever its format
+    inline bool parseSnapshotSax(const char* data, size_t size, nlohmann::json_sax<json>& sax) {
+        switch (detectSnapshotFormat(data, size)) {
+        case SNAPSHOT_FORMAT::CBOR: {
+            size_t skip = (size >= CBOR_MAGIC.size() && std::equal(CBOR_MAGIC.begin(), CBOR_MAGIC.end(), data)) ? CBOR_MAGIC.size() : 0;
+            return json::sax_parse(data + skip, data + size, &sax, json::input_format_t::cbor);
+        }
+        case SNAPSHOT_FORMAT::MSGPACK:
+            return json::sax_parse(data, data + size, &sax, json::input_format_t::msgpack);
+        default:
+            return json::sax_parse(data, data + size, &sax);
+        }
+    }
+
+    // SchemaProbe reads the first member of a snapshot and stops the parse there, so checking the
+    // version of a file costs the same whatever its size
+    class SchemaProbe : public nlohmann::json_sax<json> {
+    private:
+        int version = 1;
+        bool atSchemaKey = false;
+
+    public:
+        int getVersion() const {
+            return version;
+        }
+
+        bool number_integer(number_integer_t val) override {
+            if (atSchemaKey) {
+                version = static_cast<int>(val);
+            }
+            return false;
+        }
+        bool number_unsigned(number_unsigned_t val) override { return number_integer(static_cast<number_integer_t>(val)); }
+        bool start_object(std::size_t) override { return !atSchemaKey; }
+        bool key(string_t& val) override {
+            atSchemaKey = val == SCHEMA_KEY;
+            return atSchemaKey;
+        }
+        bool null() override { return false; }
+        bool boolean(bool) override { return false; }
+        bool number_float(number_float_t, const string_t&) override { return false; }
+        bool string(string_t&) override { return false; }
+        bool binary(binary_t&) override { return false; }
+        bool end_object() override { return false; }
+        bool start_array(std::size_t) override { return false; }
+        bool end_array() override { return false; }
+        bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception&) override { return false; }
+    };
+
+    inline int probeSchemaVersion(const char* data, size_t size) {
+        SchemaProbe probe;
+        parseSnapshotSax(data, size, probe);  // Stopped by the probe after the first member
+        return probe.getVersion();
+    }
+
+    //*********************************************************************************************************************
+    // Lazy loading: at startup only an index of the chores is built, full Chore objects are created on first use
+    enum class LOAD_MODE { EAGER, LAZY };
+
+    // Where one chore object lives in a text JSON data file
+    struct ChoreIndexEntry {
+        int id;
+        wxString name;
+        size_t offset;              // Byte offset of the chore object in the data file
+        size_t length;              // Byte length of the chore object
+        shared_ptr<Chore> chore;    // Set once the chore has been materialized
+    };
+
+    // ChoreIndexScanner walks the raw bytes of a text JSON data file and records the byte range, id and name
+    // of every object in the top-level "chores" array without decoding the rest of each chore
+    class ChoreIndexScanner {
+    private:
+        const char* data;
+        size_t size;
+        size_t pos = 0;
+
+        void skipWhitespace() {
+            while (pos < size && isspace(static_cast<unsigned char>(data[pos]))) {
+                pos++;
+            }
+        }
+
+        // Consume c (after optional whitespace) if it is next
+        bool expect(char c) {
+            skipWhitespace();
+            if (pos < size && data[pos] == c) {
+                pos++;
+                return true;
+            }
+            return false;
+        }
+
+        // pos is on the opening quote; leaves pos after the closing quote
+        bool skipString() {
+            pos++;
+            while (pos < size) {
+                char c = data[pos++];
+                if (c == '\\') {
+                    pos++;
+                }
+                else if (c == '"') {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool skipValue() {
+            skipWhitespace();
+            if (pos >= size) {
+                return false;
+            }
+            char c = data[pos];
+            if (c == '"') {
+                return skipString();
+            }
+            if (c == '{' || c == '[') {
+                int depth = 0;
+                while (pos < size) {
+                    char ch = data[pos];
+                    if (ch == '"') {
+                        if (!skipString()) {
+                            return false;
+                        }
+                        continue;
+                    }
+                    pos++;
+                    if (ch == '{' || ch == '[') {
+                        depth++;
+                    }
+                    else if ((ch == '}' || ch == ']') && --depth == 0) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+            // Number, true, false or null
+            while (pos < size && data[pos] != ',' && data[pos] != '}' && data[pos] != ']' && !isspace(static_cast<unsigned char>(data[pos]))) {
+                pos++;
+            }
+            return true;
+        }
+
+        // Read an object key including its quotes, then the ':' after it
+        bool readKey(std::string_view& key) {
+            skipWhitespace();
+            size_t start = pos;
+            if (pos >= size || data[pos] != '"' || !skipString()) {
+                return false;
+            }
+            key = std::string_view(data + start, pos - start);
+            return expect(':');
+        }
+
+        bool scanChore(vector<ChoreIndexEntry>& entries) {
+            ChoreIndexEntry entry{ -1, wxString(""), pos, 0, nullptr };
+            pos++;  // '{'
+            if (!expect('}')) {
+                do {
+                    std::string_view key;
+                    if (!readKey(key)) {
+                        return false;
+                    }
+                    skipWhitespace();
+                    size_t valueStart = pos;
+                    if (!skipValue()) {
+                        return false;
+                    }
+                    if (key == "\"id\"" || key == "\"name\"") {
+                        json value = json::parse(data + valueStart, data + pos, nullptr, false);
+                        if (key == "\"id\"" && value.is_number_integer()) {
+                            entry.id = value.get<int>();
+                        }
+                        else if (key == "\"name\"" && value.is_string()) {
+                            entry.name = wxString(value.get<std::string>());
+                        }
+                    }
+                } while (expect(','));
+                if (!expect('}')) {
+                    return false;
+                }
+            }
+            entry.length = pos - entry.offset;
+            entries.push_back(std::move(entry));
+            return true;
+        }
+
+        bool scanChores(vector<ChoreIndexEntry>& entries) {
+            choresBegin = pos;
+            pos++;  // '['
+            if (!expect(']')) {
+                do {
+                    skipWhitespace();
+                    if (pos < size && data[pos] == '{') {
+                        if (!scanChore(entries)) {
+                            return false;
+                        }
+                    }
+                    else if (!skipValue()) {
+                        return false;
+                    }
+                } while (expect(','));
+                if (!expect(']')) {
+                    return false;
+                }
+            }
+            choresEnd = pos;
+            return true;
+        }
+
+    public:
+        size_t choresBegin = 0;     // Byte range of the "chores" array, brackets included
+        size_t choresEnd = 0;
+
+        ChoreIndexScanner(const char* data, size_t size) : data(data), size(size) {}
+
+        // Index every chore of the data file; false if the file is not a well-formed JSON object
+        bool scan(vector<ChoreIndexEntry>& entries) {
+            pos = 0;
+            if (!expect('{')) {
+                return false;
+            }
+            if (expect('}')) {
+                return true;
+            }
+            do {
+                std::string_view key;
+                if (!readKey(key)) {
+                    return false;
+                }
+                skipWhitespace();
+                if (key == "\"chores\"" && pos < size && data[pos] == '[') {
+                    if (!scanChores(entries)) {
+                        return false;
+                    }
+                }
+                else if (!skipValue()) {
+                    return false;
+                }
+            } while (expect(','));
+            return expect('}');
+        }
+
+        // True if the bytes an entry points at are still one chore object of that length with that id. The sidecar
+        // index is checked only against the size and time of the file, which an edit can leave unchanged
+        static bool matches(const ChoreIndexEntry& entry, const char* data, size_t size) {
+            if (entry.offset >= size || entry.length > size - entry.offset || data[entry.offset] != '{') {
+                return false;
+            }
+            ChoreIndexScanner scanner(data, entry.offset + entry.length);
+            scanner.pos = entry.offset;
+            vector<ChoreIndexEntry> found;
+            return scanner.scanChore(found) && found[0].length == entry.length && found[0].id == entry.id;
+        }
+    };
+
+    //*********************************************************************************************************************
+    // Write to "<path>.tmp" through writeContents, fsync it and rename it over path,
+    // so readers never see a half-written file
+    inline bool writeFileAtomically(const wxString& path, const std::function<bool(wxFile&)>& writeContents) {
+        wxString tempPath = path + ".tmp";
+        wxFile file;
+        if (!file.Create(tempPath, true)) {
+            return false;
+        }
+        bool ok = writeContents(file);
+        ok = ok && file.Flush();  // fsync (_commit on Windows)
+        file.Close();
+        if (!ok) {
+            wxRemoveFile(tempPath);
+            return false;
+        }
+#ifdef __WXMSW__
+        // wxRenameFile falls back to copying on Windows, MoveFileEx replaces in one step
+        return ::MoveFileExW(tempPath.wc_str(), path.wc_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+        return wxRenameFile(tempPath, path, true);  // rename() replaces the target atomically
+#endif
+    }
+
+    inline bool writeFileAtomically(const wxString& path, const std::string& payload) {
+        return writeFileAtomically(path, [&payload](wxFile& file) { return file.Write(payload.data(), payload.size()) == payload.size(); });
+    }
+
+    // A data file snapshot as a list of byte ranges streamed to the file one after another, so a save never
+    // assembles the whole document in memory: small encoded pieces (headers, separators), fragments shared
+    // with the chores that cached them, and chores copied straight from the mapped file being replaced
+    class SnapshotPayload {
+    private:
+        struct Piece {
+            std::string text;                               // Owned bytes
+            std::shared_ptr<const std::string> fragment;    // A chore's cached serialized form
+            const char* raw = nullptr;                      // Bytes inside source
+            size_t rawSize = 0;
+            bool minify = false;                            // Raw text JSON written without its whitespace
+        };
+
+        vector<Piece> pieces;
+        std::shared_ptr<MappedFile> source;
+        size_t length = 0;
+        bool compressed = false;
+        int compressionLevel = wxZ_DEFAULT_COMPRESSION;
+
+    public:
+        SnapshotPayload() = default;
+        // A payload held in one string (manifests and the log-store head)
+        SnapshotPayload(std::string bytes) {
+            append(bytes);
+        }
+
+        void append(std::string_view bytes) {
+            if (bytes.empty()) {
+                return;
+            }
+            if (pieces.empty() || pieces.back().fragment || pieces.back().raw) {
+                pieces.emplace_back();
+            }
+            pieces.back().text.append(bytes.data(), bytes.size());
+            length += bytes.size();
+        }
+
+        void append(std::shared_ptr<const std::string> fragment) {
+            length += fragment->size();
+            pieces.push_back(Piece{ std::string(), std::move(fragment) });
+        }
+
+        // Bytes of the source file; minified text JSON takes minifiedJSONSize() bytes in the output
+        void appendRaw(const char* raw, size_t size, bool minify = false) {
+            length += minify ? minifiedJSONSize(raw, size) : size;
+            pieces.push_back(Piece{ std::string(), nullptr, raw, size, minify });
+        }
+
+        // Keep the mapped file that raw pieces point into until the payload is written
+        void keepSource(std::shared_ptr<MappedFile> mapped) {
+            source = std::move(mapped);
+        }
+
+        // Unmap the source once written; Windows cannot replace a file that is still mapped
+        void releaseSource() {
+            source.reset();
+        }
+
+        // zlib-compress the bytes on their way to the file
+        void compress(int level) {
+            compressed = true;
+            compressionLevel = level;
+        }
+
+        // Uncompressed size, which is also the offset of the next piece appended
+        size_t size() const {
+            return length;
+        }
+
+        bool empty() const {
+            return length == 0;
+        }
+
+        bool writeTo(wxFile& file) const {
+            wxFileOutputStream out(file);
+            std::unique_ptr<wxZlibOutputStream> zlib;
+            if (compressed) {
+                zlib = std::make_unique<wxZlibOutputStream>(out, compressionLevel, wxZLIB_ZLIB);
+            }
+            wxOutputStream& sink = zlib ? static_cast<wxOutputStream&>(*zlib) : out;
+            std::string minified;
+            for (const Piece& piece : pieces) {
+                std::string_view bytes = piece.fragment ? std::string_view(*piece.fragment) : piece.raw ? std::string_view(piece.raw, piece.rawSize) : std::string_view(piece.text);
+                if (piece.minify) {
+                    minified.clear();
+                    appendMinifiedJSON(minified, piece.raw, piece.rawSize);
+                    bytes = minified;
+                }
+                if (sink.Write(bytes.data(), bytes.size()).LastWrite() != bytes.size()) {
+                    return false;
+                }
+            }
+            return (!zlib || zlib->Close()) && out.IsOk();
+        }
+    };
+
+    // SnapshotWriter saves data file snapshots on a dedicated thread so the wx event loop never waits on disk
+    // Bursts of submissions are coalesced into one write; each write goes to a temp file,
+    // is fsync'ed and then renamed over the data file so a crash never leaves a half-written file
+    class SnapshotWriter {
+    public:
+        // Called on the writer thread after each write with the sequence number it contained
+        using WrittenCallback = std::function<void(unsigned long long seq, bool ok)>;
+
+    private:
+        wxString path;
+        WrittenCallback onWritten;
+        std::chrono::milliseconds coalesceDelay;
+
+        std::mutex mtx;
+        std::condition_variable wakeCv;    // Wakes the writer thread
+        std::condition_variable idleCv;    // Wakes threads waiting in flush()
+        SnapshotPayload pending;           // Latest payload, replaces any older one not yet written
+        std::map<wxString, std::string> pendingFiles;  // Other files of the same snapshot, by path
+        unsigned long long pendingSeq = 0;
+        bool hasPending = false;
+        bool writing = false;
+        bool flushRequested = false;
+        bool stopping = false;
+
+        // Statistics (guarded by mtx)
+        size_t queueDepth = 0;             // Submissions waiting to be written
+        unsigned long long submissions = 0;
+        unsigned long long writesCompleted = 0;
+        unsigned long long writesFailed = 0;
+        double lastWriteMs = 0.0;
+        double totalWriteMs = 0.0;
+
+        std::thread worker;                // Declared last so everything above exists before it starts
+
+        void run() {
+            std::unique_lock<std::mutex> lock(mtx);
+            while (true) {
+                wakeCv.wait(lock, [this]() { return hasPending || stopping; });
+                if (!hasPending) {
+                    break;  // Stopping with nothing left to write
+                }
+                // Give a burst of dirty notifications time to collapse into one write
+                wakeCv.wait_for(lock, coalesceDelay, [this]() { return stopping || flushRequested; });
+
+                SnapshotPayload payload = std::move(pending);
+                std::map<wxString, std::string> files = std::move(pendingFiles);
+                unsigned long long seq = pendingSeq;
+                pending = SnapshotPayload();
+                pendingFiles.clear();
+                hasPending = false;
+                queueDepth = 0;
+                writing = true;
+                lock.unlock();
+
+                // Other files first, so the main file never refers to data that is not on disk yet
+                auto start = std::chrono::steady_clock::now();
+                bool ok = true;
+                for (const auto& file : files) {
+                    if (!writeFileAtomically(file.first, file.second)) {
+                        wxLogError("Error saving file: %s", file.first);
+                        ok = false;
+                    }
+                }
+                if (ok && !writeFileAtomically(path, [&payload](wxFile& file) {
+                    bool written = payload.writeTo(file);
+                    payload.releaseSource();  // Before the rename replaces the file it maps
+                    return written;
+                    })) {
+                    wxLogError("Error saving file: %s", path);
+                    ok = false;
+                }
+                double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+                if (onWritten) {
+                    onWritten(seq, ok);
+                }
+
+                lock.lock();
+                writing = false;
+                lastWriteMs = elapsedMs;
+                totalWriteMs += elapsedMs;
+                ok ? writesCompleted++ : writesFailed++;
+                if (!hasPending) {
+                    flushRequested = false;
+                }
+                idleCv.notify_all();
+            }
+        }
+
+    public:
+        SnapshotWriter(const wxString& path, WrittenCallback onWritten,
+            std::chrono::milliseconds coalesceDelay = std::chrono::milliseconds(200))
+            : path(path), onWritten(onWritten), coalesceDelay(coalesceDelay),
+            worker(&SnapshotWriter::run, this) {}
+
+        // Writes anything still pending, then stops the thread
+        ~SnapshotWriter() {
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                stopping = true;
+            }
+            wakeCv.notify_all();
+            worker.join();
+        }
+
+        SnapshotWriter(const SnapshotWriter&) = delete;
+        SnapshotWriter& operator=(const SnapshotWriter&) = delete;
+
+        // Queue a serialized snapshot; a newer submission replaces one that has not been written yet
+        // files are written before the main file, and replace only queued files with the same path
+        void submit(SnapshotPayload payload, unsigned long long seq, std::map<wxString, std::string> files = {}) {
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                pending = std::move(payload);
+                for (auto& file : files) {
+                    pendingFiles[file.first] = std::move(file.second);
+                }
+                pendingSeq = seq;
+                hasPending = true;
+                queueDepth++;
+                submissions++;
+            }
+            wakeCv.notify_all();
+        }
+
+        // Block until every submitted snapshot is on disk (skips the coalescing delay)
+        void flush() {
+            std::unique_lock<std::mutex> lock(mtx);
+            if (!hasPending && !writing) {
+                return;
+            }
+            flushRequested = true;
+            wakeCv.notify_all();
+            idleCv.wait(lock, [this]() { return !hasPending && !writing; });
+        }
+
+        size_t getQueueDepth() {
+            std::lock_guard<std::mutex> lock(mtx);
+            return queueDepth;
+        }
+
+        double getLastWriteMs() {
+            std::lock_guard<std::mutex> lock(mtx);
+            return lastWriteMs;
+        }
+
+        double getAverageWriteMs() {
+            std::lock_guard<std::mutex> lock(mtx);
+            unsigned long long writes = writesCompleted + writesFailed;
+            return writes ? totalWriteMs / writes : 0.0;
+        }
+
+        // One-line summary for logging
+        wxString describeStats() {
+            std::lock_guard<std::mutex> lock(mtx);
+            unsigned long long writes = writesCompleted + writesFailed;
+            return wxString::Format("Snapshot writer: %llu submitted, %llu written, %llu failed, queue depth %lu, last write %.1f ms, average %.1f ms",
+                submissions, writesCompleted, writesFailed, static_cast<unsigned long>(queueDepth), lastWriteMs, writes ? totalWriteMs / writes : 0.0);
+        }
+    };
+    //*********************************************************************************************************************
+    // Chore feeds for bulk import and export. CSV files have a header row naming the chore fields they contain
+    // (id,name,description,...); list fields (days, tags, tools_required, materials_needed) hold their items
+    // separated by ';'. JSON Lines files hold one chore object per line.
+    enum class FEED_FORMAT { CSV, JSONL };
+
+    // .csv files are CSV, anything else (.jsonl, .ndjson) JSON Lines
+    inline FEED_FORMAT feedFormatForFile(const wxString& path) {
+        return path.Lower().EndsWith(".csv") ? FEED_FORMAT::CSV : FEED_FORMAT::JSONL;
+    }
+
+    struct ImportReport {
+        size_t rows = 0;          // Records read from the file
+        size_t imported = 0;      // Chores added
+        size_t invalid = 0;       // Records that could not be parsed or have no valid id
+        size_t duplicates = 0;    // Ids already present, or repeated in the file
+        double seconds = 0.0;
+
+        double rowsPerSecond() const {
+            return seconds > 0.0 ? rows / seconds : 0.0;
+        }
+
+        wxString describe() const {
+            return wxString::Format("Imported %lu of %lu rows (%lu invalid, %lu duplicate ids) in %.2f s, %.0f rows/s",
+                static_cast<unsigned long>(imported), static_cast<unsigned long>(rows), static_cast<unsigned long>(invalid),
+                static_cast<unsigned long>(duplicates), seconds, rowsPerSecond());
+        }
+    };
+
+    // The input is split into chunks on record boundaries and the chunks are parsed in parallel
+    class ChoreImporter {
+    private:
+        static constexpr size_t CHUNK_BYTES = 1 << 20;
+
+        struct Chunk {
+            const char* begin;
+            const char* end;
+            vector<shared_ptr<Chore>> chores;
+            size_t rows = 0;
+            size_t invalid = 0;
+            shared_ptr<ChoreArena> arena = std::make_shared<ChoreArena>();   // One per chunk, so workers never share one
+
+            Chunk(const char* begin, const char* end) : begin(begin), end(end) {}
+        };
+
+        FEED_FORMAT format;
+        vector<int> columnFields;      // CSV column -> position in choreFieldNames() (the cases of choreFromCsv), -1 if unknown
+
+        // Split one CSV record into fields (RFC 4180 quoting: "a,b" and "say ""hi""")
+        static vector<std::string> splitCsvRecord(std::string_view record) {
+            vector<std::string> fields(1);
+            bool quoted = false;
+            for (size_t i = 0; i < record.size(); i++) {
+                char c = record[i];
+                if (quoted) {
+                    if (c == '"' && i + 1 < record.size() && record[i + 1] == '"') {
+                        fields.back() += '"';
+                        i++;
+                    }
+                    else if (c == '"') {
+                        quoted = false;
+                    }
+                    else {
+                        fields.back() += c;
+                    }
+                }
+                else if (c == '"') {
+                    quoted = true;
+                }
+                else if (c == ',') {
+                    fields.emplace_back();
+                }
+                else if (c != '\r') {
+                    fields.back() += c;
+                }
+            }
+            return fields;
+        }
+
+        // End of the record starting at pos: the next newline outside quotes (or end)
+        static const char* recordEnd(const char* pos, const char* end, bool csv) {
+            bool quoted = false;
+            for (; pos < end; pos++) {
+                if (csv && *pos == '"') {
+                    quoted = !quoted;
+                }
+                else if (*pos == '\n' && !quoted) {
+                    return pos;
+                }
+            }
+            return end;
+        }
+
+        static void splitDays(const std::string& field, Chore& chore) {
+            std::stringstream stream(field);
+            std::string item;
+            while (std::getline(stream, item, ';')) {
+                if (!item.empty()) {
+                    chore.addDay(item);
+                }
+            }
+        }
+
+        static void splitList(const std::string& field, SymbolList& items) {
+            items.clear();
+            std::stringstream stream(field);
+            std::string item;
+            while (std::getline(stream, item, ';')) {
+                items.push_back(intern(item));
+            }
+        }
+
+        // Build a chore straight from CSV fields (no intermediate json); missing columns get the usual defaults
+        shared_ptr<Chore> choreFromCsv(const vector<std::string>& fields, const shared_ptr<ChoreArena>& arena) const {
+            Chore record;   // Built as its class once the difficulty column has been read
+            Chore* chore = &record;
+            chore->id = -1;
+            chore->earnings = 0;
+            chore->difficulty = DIFFICULTY::EASY;
+            chore->priority = PRIORITY::LOW;
+            chore->status = STATUS::NOT_STARTED;
+            for (size_t i = 0; i < columnFields.size() && i < fields.size(); i++) {
+                const std::string& value = fields[i];
+                if (columnFields[i] < 0 || value.empty()) {
+                    continue;
+                }
+                switch (columnFields[i]) {
+                case 0:
+                case 5: {
+                    char* end = nullptr;
+                    long number = std::strtol(value.c_str(), &end, 10);
+                    if (*end != '\0') {
+                        return nullptr;
+                    }
+                    (columnFields[i] == 0 ? chore->id : chore->earnings) = static_cast<int>(number);
+                    break;
+                }
+                case 1: chore->name = wxString(value); break;
+                case 2: chore->description = wxString(value); break;
+                case 3: chore->frequency = intern(value); break;
+                case 4: chore->estimated_time = intern(value); break;
+                case 6: splitDays(value, *chore); break;
+                case 7: chore->location = intern(value); break;
+                case 8: splitList(value, chore->tools_required); break;
+                case 9: splitList(value, chore->materials_needed); break;
+                case 10: chore->notes = wxString(value); break;
+                case 11: splitList(value, chore->tags); break;
+                case 12: chore->difficulty = value == "medium" ? DIFFICULTY::MEDIUM : value == "hard" ? DIFFICULTY::HARD : DIFFICULTY::EASY; break;
+                case 13: chore->priority = value == "moderate" ? PRIORITY::MODERATE : value == "high" ? PRIORITY::HIGH : PRIORITY::LOW; break;
+                case 14: chore->status = value == "in_progress" ? STATUS::IN_PROGRESS : value == "completed" ? STATUS::COMPLETED : STATUS::NOT_STARTED; break;
+                }
+            }
+            shared_ptr<Chore> typed = Chore::create(record.difficulty, arena);
+            *typed = record;
+            return typed;
+        }
+
+        void parseChunk(Chunk& chunk) const {
+            const char* pos = chunk.begin;
+            while (pos < chunk.end) {
+                const char* end = recordEnd(pos, chunk.end, format == FEED_FORMAT::CSV);
+                std::string_view record(pos, static_cast<size_t>(end - pos));
+                pos = end + 1;
+                if (record.find_first_not_of(" \t\r") == std::string_view::npos) {
+                    continue;
+                }
+                chunk.rows++;
+                shared_ptr<Chore> chore;
+                if (format == FEED_FORMAT::CSV) {
+                    chore = choreFromCsv(splitCsvRecord(record), chunk.arena);
+                }
+                else {
+                    json choreJson = json::parse(record.begin(), record.end(), nullptr, false);
+                    if (!choreJson.is_discarded()) {
+                        chore = Chore::fromCurrentSchema(choreJson, chunk.arena);
+                        if (!chore) {
+                            // Rows with missing or null fields go through the tolerant constructor, as loads do
+                            try {
+                                chore = Chore::fromJSON(choreJson, chunk.arena);
+                            }
+                            catch (const json::exception&) {
+                                // Counted as invalid below
+                            }
+                        }
+                    }
+                }
+                if (chore && chore->getId() >= 0) {
+                    chunk.chores.push_back(chore);
+                }
+                else {
+                    chunk.invalid++;
+                }
+            }
+        }
+
+    public:
+        explicit ChoreImporter(FEED_FORMAT format) : format(format) {}
+
+        // Parse the whole buffer into chores, in input order; rows and invalid are counted into report
+        vector<shared_ptr<Chore>> parse(const char* data, size_t size, ImportReport& report) {
+            const char* pos = data;
+            const char* end = data + size;
+            if (format == FEED_FORMAT::CSV) {
+                const char* headerEnd = recordEnd(pos, end, true);
+                for (const auto& column : splitCsvRecord(std::string_view(pos, static_cast<size_t>(headerEnd - pos)))) {
+                    auto field = std::find(choreFieldNames().begin(), choreFieldNames().end(), column);
+                    columnFields.push_back(field != choreFieldNames().end() ? static_cast<int>(field - choreFieldNames().begin()) : -1);
+                }
+                pos = headerEnd < end ? headerEnd + 1 : end;
+            }
+
+            // Chunks of about CHUNK_BYTES, each ending on a record boundary
+            vector<Chunk> chunks;
+            while (pos < end) {
+                const char* cut = pos + std::min<size_t>(CHUNK_BYTES, static_cast<size_t>(end - pos));
+                if (cut < end && format == FEED_FORMAT::CSV) {
+                    // A newline inside a quoted field is not a boundary: walk the records from the chunk start
+                    const char* scan = pos;
+                    while ((scan = recordEnd(scan, end, true)) < cut) {
+                        scan++;
+                    }
+                    cut = scan;
+                }
+                else if (cut < end) {
+                    cut = recordEnd(cut, end, false);
+                }
+                chunks.emplace_back(pos, cut);
+                pos = cut < end ? cut + 1 : end;
+            }
+
+            std::atomic<size_t> next{ 0 };
+            size_t threadCount = std::min<size_t>(chunks.size(), std::max(1u, std::thread::hardware_concurrency()));
+            vector<std::thread> workers;
+            for (size_t t = 0; t < threadCount; t++) {
+                workers.emplace_back([&]() {
+                    for (size_t i = next++; i < chunks.size(); i = next++) {
+                        parseChunk(chunks[i]);
+                    }
+                });
+            }
+            for (auto& worker : workers) {
+                worker.join();
+            }
+
+            vector<shared_ptr<Chore>> parsed;
+            for (auto& chunk : chunks) {
+                report.rows += chunk.rows;
+                report.invalid += chunk.invalid;
+                parsed.insert(parsed.end(), chunk.chores.begin(), chunk.chores.end());
+            }
+            return parsed;
+        }
+    };
+
+    // What ChoreManager::exportChores writes
+    struct ExportOptions {
+        FEED_FORMAT format = FEED_FORMAT::CSV;
+        vector<std::string> fields;                   // Columns to write, all chore fields when empty
+        std::function<bool(const Chore&)> filter;     // Rows to write, all when empty
+        std::string sortBy;                           // Field to order rows by, store order when empty
+        bool ascending = true;
+    };
+
+    // Summaries ChoreManager::exportReport writes: chores, completed chores and earnings per day, status or difficulty
+    enum class REPORT { BY_DAY, BY_STATUS, BY_DIFFICULTY };
+
+    // Writes chores as CSV or JSON Lines rows through a large output buffer
+    class ChoreFeedWriter {
+    private:
+        std::ofstream out;
+        vector<char> buffer;
+        FEED_FORMAT format;
+        vector<std::string> fields;
+        std::string line;
+
+        static void appendCsvField(std::string& line, const std::string& value) {
+            if (value.find_first_of(",\"\r\n") == std::string::npos) {
+                line += value;
+                return;
+            }
+            line += '"';
+            for (char c : value) {
+                line += c;
+                if (c == '"') {
+                    line += '"';
+                }
+            }
+            line += '"';
+        }
+
+    public:
+        ChoreFeedWriter(const wxString& path, FEED_FORMAT format, const vector<std::string>& fields)
+            : buffer(1 << 20), format(format), fields(fields.empty() ? choreFieldNames() : fields) {
+            out.rdbuf()->pubsetbuf(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            out.open(path.ToStdString(), std::ios::binary | std::ios::trunc);
+            if (out && format == FEED_FORMAT::CSV) {
+                for (size_t i = 0; i < this->fields.size(); i++) {
+                    out << (i ? "," : "") << this->fields[i];
+                }
+                out << "\n";
+            }
+        }
+
+        bool isOpen() const {
+            return out.is_open() && out.good();
+        }
+
+        void write(const Chore& chore) {
+            writeRow(chore.toJSON());
+        }
+
+        // Write the row's values of the selected fields, such as a chore record or a report line
+        void writeRow(json full) {
+            line.clear();
+            if (format == FEED_FORMAT::JSONL) {
+                json row = json::object();
+                for (const auto& field : fields) {
+                    if (full.contains(field)) {
+                        row[field] = std::move(full[field]);
+                    }
+                }
+                line = row.dump();
+            }
+            else {
+                for (size_t i = 0; i < fields.size(); i++) {
+                    if (i) {
+                        line += ',';
+                    }
+                    auto value = full.find(fields[i]);
+                    if (value == full.end()) {
+                        continue;
+                    }
+                    if (value->is_string()) {
+                        appendCsvField(line, value->get_ref<const std::string&>());
+                    }
+                    else if (value->is_array()) {
+                        std::string items;
+                        for (const auto& item : *value) {
+                            // Lists of objects, such as a hard chore's subtasks, are written as their JSON
+                            items += (items.empty() ? "" : ";") + (item.is_string() ? item.get<std::string>() : item.dump());
+                        }
+                        appendCsvField(line, items);
+                    }
+                    else {
+                        line += value->dump();
+                    }
+                }
+            }
+            line += '\n';
+            out.write(line.data(), static_cast<std::streamsize>(line.size()));
+        }
+
+        bool close() {
+            out.flush();
+            bool ok = out.good();
+            out.close();
+            return ok;
+        }
+    };
+
+    // Delta sync: a delta is {"chores": [...], "removed": [ids]} where each changed chore is sent as
+    // {"id": N, "patch": [...]}, a JSON Patch (json::diff) against the chore as it was last synced, or as
+    // {"id": N, "chore": {...}} when it is new or the patch would be larger than the chore itself
+    struct SyncReport {
+        size_t applied = 0;     // Chores added, replaced or patched
+        size_t removed = 0;
+        size_t conflicts = 0;   // Patches for chores that are missing here or no longer match
+
+        SyncReport& operator+=(const SyncReport& other) {
+            applied += other.applied;
+            removed += other.removed;
+            conflicts += other.conflicts;
+            return *this;
+        }
+
+        wxString describe() const {
+            return wxString::Format("Applied %zu chores, removed %zu, %zu conflicts", applied, removed, conflicts);
+        }
+    };
+
+    //*********************************************************************************************************************
+    // PersonalChoreList stores the chores a user saved from the chore details window as JSON Lines,
+    // one compact {"id":N,"chore":{...}} record per line, with an in-memory index of the saved ids
+    enum class LIST_SAVE { SAVED, ALREADY_SAVED, FAILED };
+
+    class PersonalChoreList {
+    private:
+        wxString path;
+        std::unordered_map<int, size_t> offsets;   // Chore id -> byte offset of its line
+
+        // Id of a record line from its "{"id":N," prefix, without parsing the chore
+        static bool readRecordId(const std::string& line, int& id) {
+            static const std::string prefix = "{\"id\":";
+            if (line.compare(0, prefix.size(), prefix) != 0) {
+                return false;
+            }
+            const char* begin = line.c_str() + prefix.size();
+            char* end = nullptr;
+            long value = std::strtol(begin, &end, 10);
+            if (end == begin || *end != ',') {
+                return false;
+            }
+            id = static_cast<int>(value);
+            return true;
+        }
+
+        static std::string makeRecord(int id, const json& chore) {
+            return "{\"id\":" + std::to_string(id) + ",\"chore\":" + chore.dump() + "}\n";
+        }
+
+        // Rebuild the id index with one pass over the lines of the file
+        void scan() {
+            offsets.clear();
+            std::ifstream in(path.ToStdString(), std::ios::binary);
+            std::string line;
+            size_t offset = 0;
+            while (std::getline(in, line)) {
+                int id;
+                if (readRecordId(line, id)) {
+                    offsets.emplace(id, offset);
+                }
+                offset += line.size() + 1;
+            }
+        }
+
+        // Convert the old UserChoreList.json (pretty-printed objects appended one after another)
+        void importLegacy(const wxString& legacyPath) {
+            std::ifstream in(legacyPath.ToStdString());
+            std::ofstream out(path.ToStdString(), std::ios::app | std::ios::binary);
+            if (!in || !out) {
+                return;
+            }
+            size_t imported = 0;
+            while (in >> std::ws && in.peek() != EOF) {
+                json chore;
+                try {
+                    in >> chore;  // Reads one value and leaves the stream at the next
+                }
+                catch (const json::exception& e) {
+                    wxLogWarning("Stopped importing %s: %s", legacyPath, e.what());
+                    break;
+                }
+                if (!chore.is_object()) {
+                    continue;
+                }
+                int id = chore.value("id", -1);
+                if (offsets.emplace(id, static_cast<size_t>(out.tellp())).second) {
+                    out << makeRecord(id, chore);
+                    imported++;
+                }
+            }
+            wxLogMessage("Imported %lu chores from %s.", static_cast<unsigned long>(imported), legacyPath);
+        }
+
+    public:
+        PersonalChoreList(const wxString& path, const wxString& legacyPath = "") : path(path) {
+            if (!wxFileExists(path) && !legacyPath.IsEmpty() && wxFileExists(legacyPath)) {
+                importLegacy(legacyPath);
+            }
+            scan();
+        }
+
+        // Append the chore unless a chore with the same id is already in the list
+        LIST_SAVE add(const Chore& chore) {
+            int id = chore.getId();
+            if (offsets.count(id)) {
+                return LIST_SAVE::ALREADY_SAVED;
+            }
+            std::ofstream out(path.ToStdString(), std::ios::app | std::ios::binary);
+            if (!out) {
+                return LIST_SAVE::FAILED;
+            }
+            out.seekp(0, std::ios::end);
+            size_t offset = static_cast<size_t>(out.tellp());
+            out << makeRecord(id, chore.toJSON());
+            if (!out.flush()) {
+                return LIST_SAVE::FAILED;
+            }
+            offsets.emplace(id, offset);
+            return LIST_SAVE::SAVED;
+        }
+
+        bool contains(int choreId) const {
+            return offsets.count(choreId) > 0;
+        }
+
+        size_t size() const {
+            return offsets.size();
+        }
+
+        // Read the saved chores one line at a time; return false from visit to stop early
+        void forEach(const std::function<bool(const json& chore)>& visit) const {
+            std::ifstream in(path.ToStdString(), std::ios::binary);
+            std::string line;
+            while (std::getline(in, line)) {
+                json record = json::parse(line, nullptr, false);
+                if (record.is_discarded() || !record.contains("chore")) {
+                    continue;
+                }
+                if (!visit(record["chore"])) {
+                    return;
+                }
+            }
+        }
+
+        // Full chore saved under choreId, or null
+        json find(int choreId) const {
+            auto found = offsets.find(choreId);
+            if (found == offsets.end()) {
+                return nullptr;
+            }
+            std::ifstream in(path.ToStdString(), std::ios::binary);
+            std::string line;
+            if (!in.seekg(static_cast<std::streamoff>(found->second)) || !std::getline(in, line)) {
+                return nullptr;
+            }
+            json record = json::parse(line, nullptr, false);
+            return record.is_discarded() ? json(nullptr) : record.value("chore", json(nullptr));
+        }
+    };
+    //*********************************************************************************************************************
+    // ProfileStore keeps one directory per user under root, named by a hash of the username:
+    // "<root>/<hash>/profile.json" holds the profile and "<root>/<hash>/data.json" that user's chores.
+    // Finding a user opens one file, however many users are registered.
+    class ProfileStore {
+    private:
+        wxString root;
+        std::unordered_map<std::string, wxString> directories;   // Username -> partition directory, once looked up
+
+        // 64-bit FNV-1a, stable across compilers and runs (unlike std::hash)
+        static unsigned long long hashUsername(const std::string& username) {
+            unsigned long long hash = 14695981039346656037ULL;
+            for (unsigned char c : username) {
+                hash = (hash ^ c) * 1099511628211ULL;
+            }
+            return hash;
+        }
+
+        static json readProfile(const wxString& directory) {
+            std::ifstream in((directory + wxFileName::GetPathSeparator() + "profile.json").ToStdString(), std::ios::binary);
+            if (!in) {
+                return nullptr;
+            }
+            json profile = json::parse(in, nullptr, false);
+            return profile.is_discarded() ? json(nullptr) : profile;
+        }
+
+        // Directory holding username's partition, or the free slot it would take;
+        // two names with the same hash probe "<hash>-1", "<hash>-2", ... An existing directory belongs to
+        // someone even if its profile cannot be read, so a new user never takes over another's partition
+        wxString directoryFor(const std::string& username) {
+            auto cached = directories.find(username);
+            if (cached != directories.end()) {
+                return cached->second;
+            }
+            wxString base = root + wxFileName::GetPathSeparator() + wxString::Format("%016llx", hashUsername(username));
+            wxString directory = base;
+            for (int probe = 1; wxDirExists(directory); probe++) {
+                json profile = readProfile(directory);
+                if (profile.is_object() && profile.value("username", "") == username) {
+                    break;
+                }
+                directory = base + wxString::Format("-%d", probe);
+            }
+            directories[username] = directory;
+            return directory;
+        }
+
+    public:
+        explicit ProfileStore(const wxString& root) : root(root) {}
+
+        bool exists(const wxString& username) {
+            return !getProfile(username).is_null();
+        }
+
+        // The stored profile, or null for an unknown user
+        json getProfile(const wxString& username) {
+            return readProfile(directoryFor(username.ToStdString()));
+        }
+
+        // Create or replace a profile; only that user's profile file is written
+        bool saveProfile(const wxString& username, const wxString& theme, bool notify) {
+            wxString directory = directoryFor(username.ToStdString());
+            if (!wxDirExists(directory) && !wxFileName::Mkdir(directory, wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL)) {
+                return false;
+            }
+            json profile = { {"username", username.ToStdString()}, {"theme", theme.ToStdString()}, {"notify", notify} };
+            return writeFileAtomically(directory + wxFileName::GetPathSeparator() + "profile.json", profile.dump(4) + "\n");
+        }
+
+        // Data file of the user's own chore partition
+        wxString getDataFile(const wxString& username) {
+            return directoryFor(username.ToStdString()) + wxFileName::GetPathSeparator() + "data.json";
+        }
+
+        // Move the profiles kept in the "user_profiles" section of an old shared data file into the store
+        size_t importLegacyProfiles(const wxString& dataFile) {
+            MappedFile mapped(dataFile);
+            if (!mapped.isOpen()) {
+                return 0;
+            }
+            ChoreSaxLoader loader([](shared_ptr<Chore>) {});  // Only the top-level sections are needed
+            if (!parseSnapshotSax(mapped.getData(), mapped.getSize(), loader) || !loader.getRetained().contains("user_profiles")) {
+                return 0;
+            }
+            size_t imported = 0;
+            for (const auto& [name, profile] : loader.getRetained()["user_profiles"].items()) {
+                if (!exists(name) && saveProfile(name, wxString(profile.value("theme", "light")), profile.value("notify", false))) {
+                    imported++;
+                }
+            }
+            return imported;
+        }
+    };
+    //*********************************************************************************************************************
+    // Chore records: "{"id":N,"chore":{...}}" lines, or "{"id":N}" once the chore is removed. The log store and
+    // the delta sync baseline keep them in append-only files where later lines win
+    inline std::string makeChoreRecord(int id, const std::string& chore) {
+        return "{\"id\":" + std::to_string(id) + (chore.empty() ? "" : ",\"chore\":" + chore) + "}\n";
+    }
+
+    // Split a record line (without its newline) into id and chore JSON without parsing the chore; chore is
+    // left empty for a removal. Returns false for anything else, e.g. a line torn by a crash
+    inline bool splitChoreRecord(std::string_view line, int& id, std::string_view& chore) {
+        static const std::string_view prefix = "{\"id\":";
+        static const std::string_view field = ",\"chore\":";
+        if (line.size() <= prefix.size() || line.substr(0, prefix.size()) != prefix || line.back() != '}') {
+            return false;
+        }
+        size_t pos = prefix.size();
+        bool negative = line[pos] == '-';
+        if (negative) {
+            pos++;
+        }
+        size_t digits = pos;
+        long long value = 0;
+        while (pos < line.size() && line[pos] >= '0' && line[pos] <= '9') {
+            value = value * 10 + (line[pos++] - '0');
+        }
+        if (pos == digits) {
+            return false;
+        }
+        id = static_cast<int>(negative ? -value : value);
+        chore = std::string_view();
+        if (pos + 1 == line.size()) {
+            return true;
+        }
+        if (line.substr(pos, field.size()) != field) {
+            return false;
+        }
+        chore = line.substr(pos + field.size(), line.size() - pos - field.size() - 1);
+        return !chore.empty();
+    }
+
+    //*********************************************************************************************************************
+    // ChoreLogStore keeps chores as records in append-only segment files "<directory>/segment-<n>.log". An in-memory
+    // hash index maps each id to the byte range of its latest record, so a put is one append and a get one
+    // positioned read however many chores there are. Once superseded records make up half of the sealed segments,
+    // a background thread copies the live ones forward into the active segment and deletes the sealed ones.
+    class ChoreLogStore {
+    private:
+        struct Location {
+            unsigned segment;
+            size_t offset;     // Byte offset of the record in its segment
+            size_t length;     // Byte length of the record, newline included
+        };
+        static constexpr size_t SEGMENT_BYTES = 4 * 1024 * 1024;      // Start a new segment past this size
+        static constexpr size_t COMPACT_MIN_BYTES = 1024 * 1024;      // Never compact for less stale data than this
+
+        wxString directory;
+        std::unordered_map<int, Location> index;     // Chore id -> latest record
+        std::map<unsigned, size_t> segmentBytes;     // Size of every segment
+        std::map<unsigned, size_t> segmentStale;     // Bytes of superseded records and tombstones per segment
+        size_t sealedBytes = 0;                      // Totals over every segment but the active one
+        size_t sealedStale = 0;
+        unsigned activeSegment = 0;
+        wxFile active;                               // Append handle of the active segment
+        std::map<unsigned, std::unique_ptr<wxFile>> readers;
+        std::mutex mutex;                            // Guards everything above
+        std::condition_variable wake;
+        bool compactRequested = false;
+        bool stopping = false;
+        std::thread compactor;                       // Declared last so it starts after everything it uses
+
+        wxString segmentPath(unsigned segment) const {
+            return directory + wxFileName::GetPathSeparator() + wxString::Format("segment-%06u.log", segment);
+        }
+
+        // Seal the active segment and start the next one
+        void rollSegment() {
+            active.Close();
+            sealedBytes += segmentBytes[activeSegment];
+            sealedStale += segmentStale[activeSegment];
+            activeSegment++;
+            segmentBytes[activeSegment] = 0;
+            segmentStale[activeSegment] = 0;
+        }
+
+        // Append one record to the active segment; the caller holds mutex
+        bool appendRecord(int id, const std::string& chore, Location& where) {
+            if (segmentBytes[activeSegment] >= SEGMENT_BYTES) {
+                rollSegment();
+            }
+            if (!active.IsOpened() && !active.Open(segmentPath(activeSegment), wxFile::write_append)) {
+                wxLogError("Error opening segment: %s", segmentPath(activeSegment));
+                return false;
+            }
+            std::string record = makeChoreRecord(id, chore);
+            if (active.Write(record.data(), record.size()) != record.size()) {
+                wxLogError("Error writing segment: %s", segmentPath(activeSegment));
+                segmentBytes[activeSegment] = SEGMENT_BYTES;  // Leave a torn record at the end of a sealed segment
+                return false;
+            }
+            where = { activeSegment, segmentBytes[activeSegment], record.size() };
+            segmentBytes[activeSegment] += record.size();
+            return true;
+        }
+
+        // Count a record that no longer holds the latest state of its chore; the caller holds mutex
+        void retire(const Location& old) {
+            segmentStale[old.segment] += old.length;
+            if (old.segment != activeSegment) {
+                sealedStale += old.length;
+            }
+            if (!compactRequested && worthCompacting()) {
+                compactRequested = true;
+                wake.notify_one();
+            }
+        }
+
+        bool worthCompacting() const {
+            return sealedStale >= COMPACT_MIN_BYTES && sealedStale * 2 >= sealedBytes;
+        }
+
+        // Read the chore JSON of a record; the caller holds mutex
+        bool readRecord(const Location& where, std::string& chore) {
+            std::unique_ptr<wxFile>& reader = readers[where.segment];
+            if (!reader) {
+                reader = std::make_unique<wxFile>();
+                if (!reader->Open(segmentPath(where.segment), wxFile::read)) {
+                    readers.erase(where.segment);
+                    return false;
+                }
+            }
+            std::string record(where.length, '\0');
+            if (reader->Seek(static_cast<wxFileOffset>(where.offset)) == wxInvalidOffset ||
+                reader->Read(&record[0], record.size()) != static_cast<ssize_t>(record.size())) {
+                return false;
+            }
+            int id;
+            std::string_view choreJson;
+            if (!splitChoreRecord(std::string_view(record).substr(0, record.size() - 1), id, choreJson) || choreJson.empty()) {
+                return false;
+            }
+            chore.assign(choreJson);
+            return true;
+        }
+
+        // Call visit for every complete record of a segment's contents with its location
+        static void forEachRecord(unsigned segment, const std::string& data, const std::function<void(const Location&, int, std::string_view)>& visit) {
+            size_t pos = 0;
+            for (size_t end = data.find('\n'); end != std::string::npos; pos = end + 1, end = data.find('\n', pos)) {
+                int id;
+                std::string_view chore;
+                if (splitChoreRecord(std::string_view(data).substr(pos, end - pos), id, chore)) {
+                    visit({ segment, pos, end - pos + 1 }, id, chore);
+                }
+            }
+        }
+
+        static std::string readSegment(const wxString& path) {
+            std::ifstream in(path.ToStdString(), std::ios::binary);
+            return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        }
+
+        // Rebuild the index from the segments, oldest first
+        void scanSegments() {
+            wxArrayString files;
+            if (wxDir::GetAllFiles(directory, &files, "segment-*.log", wxDIR_FILES) > 0) {
+                files.Sort();
+            }
+            bool tornTail = false;
+            for (const auto& file : files) {
+                unsigned segment = static_cast<unsigned>(std::strtoul(file.Mid(file.rfind("segment-") + 8).c_str(), nullptr, 10));
+                std::string data = readSegment(file);
+                size_t live = 0;
+                forEachRecord(segment, data, [&](const Location& where, int id, std::string_view chore) {
+                    live += where.length;
+                    auto it = index.find(id);
+                    if (it != index.end()) {
+                        segmentStale[it->second.segment] += it->second.length;
+                    }
+                    if (chore.empty()) {
+                        segmentStale[segment] += where.length;
+                        if (it != index.end()) {
+                            index.erase(it);
+                        }
+                    }
+                    else {
+                        index[id] = where;
+                    }
+                    });
+                segmentBytes[segment] = data.size();
+                segmentStale[segment] += data.size() - live;  // Torn or unreadable lines
+                activeSegment = segment;
+                tornTail = !data.empty() && data.back() != '\n';
+            }
+            // Appends never follow a torn record
+            if (tornTail) {
+                activeSegment++;
+            }
+            segmentBytes.emplace(activeSegment, 0);
+            segmentStale.emplace(activeSegment, 0);
+            for (const auto& segment : segmentBytes) {
+                if (segment.first != activeSegment) {
+                    sealedBytes += segment.second;
+                    sealedStale += segmentStale[segment.first];
+                }
+            }
+        }
+
+        // Copy the live records of every sealed segment forward into the active one and delete the sealed
+        // segments, oldest first so a dropped tombstone never uncovers an older record of its chore
+        bool compact() {
+            vector<unsigned> sealed;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                for (const auto& segment : segmentBytes) {
+                    if (segment.first != activeSegment) {
+                        sealed.push_back(segment.first);
+                    }
+                }
+            }
+            for (unsigned segment : sealed) {
+                std::string data = readSegment(segmentPath(segment));  // Sealed segments never change
+                std::lock_guard<std::mutex> lock(mutex);
+                bool ok = true;
+                forEachRecord(segment, data, [&](const Location& where, int id, std::string_view chore) {
+                    auto it = index.find(id);
+                    if (ok && !chore.empty() && it != index.end() && it->second.segment == segment && it->second.offset == where.offset) {
+                        ok = appendRecord(id, std::string(chore), it->second);
+                    }
+                    });
+                // The copies must be on disk before the only other copy goes away
+                if (!ok || (active.IsOpened() && !active.Flush())) {
+                    return false;
+                }
+                readers.erase(segment);
+                wxRemoveFile(segmentPath(segment));
+                sealedBytes -= segmentBytes[segment];
+                sealedStale -= segmentStale[segment];
+                segmentBytes.erase(segment);
+                segmentStale.erase(segment);
+            }
+            return true;
+        }
+
+        void run() {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (true) {
+                wake.wait(lock, [this] { return stopping || compactRequested; });
+                if (stopping) {
+                    return;
+                }
+                lock.unlock();
+                bool ok = compact();
+                lock.lock();
+                // Segments sealed while compacting may already need another pass
+                compactRequested = ok && worthCompacting();
+            }
+        }
+
+    public:
+        explicit ChoreLogStore(const wxString& directory) : directory(directory) {
+            if (!wxDirExists(directory)) {
+                wxFileName::Mkdir(directory, wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL);
+            }
+            scanSegments();
+            compactor = std::thread([this] { run(); });
+        }
+
+        ~ChoreLogStore() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            wake.notify_one();
+            compactor.join();
+            if (active.IsOpened()) {
+                active.Flush();
+            }
+        }
+
+        // Write the latest state of a chore (its compact JSON)
+        bool put(int id, const std::string& chore) {
+            std::lock_guard<std::mutex> lock(mutex);
+            Location where;
+            if (!appendRecord(id, chore, where)) {
+                return false;
+            }
+            auto it = index.find(id);
+            if (it != index.end()) {
+                retire(it->second);
+                it->second = where;
+            }
+            else {
+                index.emplace(id, where);
+            }
+            return true;
+        }
+
+        bool remove(int id) {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = index.find(id);
+            if (it == index.end()) {
+                return true;
+            }
+            Location where;
+            if (!appendRecord(id, std::string(), where)) {
+                return false;
+            }
+            retire(it->second);
+            index.erase(it);
+            retire(where);  // A tombstone is only needed until the older records are compacted away
+            return true;
+        }
+
+        bool get(int id, std::string& chore) {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = index.find(id);
+            return it != index.end() && readRecord(it->second, chore);
+        }
+
+        bool contains(int id) {
+            std::lock_guard<std::mutex> lock(mutex);
+            return index.count(id) > 0;
+        }
+
+        // Ids of every live chore, in ascending order
+        vector<int> ids() {
+            std::lock_guard<std::mutex> lock(mutex);
+            vector<int> result;
+            result.reserve(index.size());
+            for (const auto& entry : index) {
+                result.push_back(entry.first);
+            }
+            std::sort(result.begin(), result.end());
+            return result;
+        }
+
+        size_t size() {
+            std::lock_guard<std::mutex> lock(mutex);
+            return index.size();
+        }
+
+        // Call visit with every live chore, reading the segments sequentially; visit must not use the store
+        void forEach(const std::function<void(int id, std::string_view chore)>& visit) {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (const auto& segment : segmentBytes) {
+                if (segment.first == activeSegment && active.IsOpened()) {
+                    active.Flush();
+                }
+                std::string data = readSegment(segmentPath(segment.first));
+                forEachRecord(segment.first, data, [&](const Location& where, int id, std::string_view chore) {
+                    auto it = index.find(id);
+                    if (!chore.empty() && it != index.end() && it->second.segment == where.segment && it->second.offset == where.offset) {
+                        visit(id, chore);
+                    }
+                    });
+            }
+        }
+
+        // fsync the active segment
+        bool sync() {
+            std::lock_guard<std::mutex> lock(mutex);
+            return !active.IsOpened() || active.Flush();
+        }
+
+        // Drop every chore and segment
+        void clear() {
+            std::lock_guard<std::mutex> lock(mutex);
+            active.Close();
+            readers.clear();
+            for (const auto& segment : segmentBytes) {
+                wxRemoveFile(segmentPath(segment.first));
+            }
+            index.clear();
+            segmentBytes.clear();
+            segmentStale.clear();
+            sealedBytes = 0;
+            sealedStale = 0;
+            activeSegment = 0;
+            segmentBytes[0] = 0;
+            segmentStale[0] = 0;
+        }
+    };
+
+    // Run body(0) ... body(count - 1) on one thread per core; each index is taken by exactly one thread
+    inline void parallelFor(size_t count, const std::function<void(size_t)>& body) {
+        size_t threadCount = std::min<size_t>(count, std::max(1u, std::thread::hardware_concurrency()));
+        if (threadCount <= 1) {
+            for (size_t i = 0; i < count; i++) {
+                body(i);
+            }
+            return;
+        }
+        std::atomic<size_t> next{ 0 };
+        vector<std::thread> threads;
+        for (size_t t = 0; t < threadCount; t++) {
+            threads.emplace_back([&]() {
+                for (size_t i = next++; i < count; i = next++) {
+                    body(i);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    //*********************************************************************************************************************
+    // What happened to a chore, as reported to ChoreManager listeners; RELOADED means everything may have changed
+    enum class CHORE_EVENT { ADDED, CHANGED, REMOVED, RELOADED };
+
+    //*********************************************************************************************************************
+    // ChoreTable holds the fields that scans, filters, sorts and totals look at as one dense array per field (a struct
+    // of arrays), so a pass over earnings reads only earnings instead of chasing a pointer to a whole Chore per row.
+    // A Row is a position in the columns; getId and ChoreManager::getChoreById lead from a row back to its full Chore
+    class ChoreTable {
+    public:
+        using Row = uint32_t;
+
+    private:
+        vector<int> ids;
+        vector<int> earnings;
+        vector<DIFFICULTY> difficulties;
+        vector<PRIORITY> priorities;
+        vector<STATUS> statuses;
+        vector<DayMask> dayMasks;
+        vector<int> minutes;                               // Estimated time in minutes
+        std::unordered_map<int, Row> rowsById;
+        std::unordered_map<Symbol, int> minutesBySymbol;   // Estimated times repeat, so each is parsed once
+
+        // Rows ordered by one column, ties keeping their order
+        template<typename T>
+        void sortRows(vector<Row>& rows, const vector<T>& column, bool ascending) const {
+            std::stable_sort(rows.begin(), rows.end(), [&column, ascending](Row a, Row b) {
+                return ascending ? column[a] < column[b] : column[b] < column[a];
+                });
+        }
+
+    public:
+        // Minutes in an estimated time such as "45 minutes", "1 hour" or "1.5 hours"; 0 if it has no number
+        static int parseMinutes(const wxString& text) {
+            std::string value = text.Lower().ToStdString();
+            char* end = nullptr;
+            double amount = std::strtod(value.c_str(), &end);
+            if (end == value.c_str() || amount < 0) {
+                return 0;
+            }
+            std::string unit(end);
+            double scale = unit.find("day") != std::string::npos ? 24 * 60 : unit.find("h") != std::string::npos ? 60 : 1;
+            return static_cast<int>(amount * scale + 0.5);
+        }
+
+        void clear() {
+            ids.clear();
+            earnings.clear();
+            difficulties.clear();
+            priorities.clear();
+            statuses.clear();
+            dayMasks.clear();
+            minutes.clear();
+            rowsById.clear();
+        }
+
+        void reserve(size_t count) {
+            ids.reserve(count);
+            earnings.reserve(count);
+            difficulties.reserve(count);
+            priorities.reserve(count);
+            statuses.reserve(count);
+            dayMasks.reserve(count);
+            minutes.reserve(count);
+            rowsById.reserve(count);
+        }
+
+        // Add a row for chore, or overwrite the row that already has its id
+        Row append(const Chore& chore) {
+            auto inserted = rowsById.emplace(chore.getId(), static_cast<Row>(ids.size()));
+            Row row = inserted.first->second;
+            if (inserted.second) {
+                ids.push_back(chore.getId());
+                earnings.emplace_back();
+                difficulties.emplace_back();
+                priorities.emplace_back();
+                statuses.emplace_back();
+                dayMasks.emplace_back();
+                minutes.emplace_back();
+            }
+            auto parsed = minutesBySymbol.find(chore.getEstimatedTimeSymbol());
+            if (parsed == minutesBySymbol.end()) {
+                parsed = minutesBySymbol.emplace(chore.getEstimatedTimeSymbol(), parseMinutes(chore.getEstimatedTime())).first;
+            }
+            earnings[row] = chore.getEarnings();
+            difficulties[row] = chore.getDifficulty();
+            priorities[row] = chore.getPriority();
+            statuses[row] = chore.getStatus();
+            dayMasks[row] = chore.getDayMask();
+            minutes[row] = parsed->second;
+            return row;
+        }
+
+        size_t size() const {
+            return ids.size();
+        }
+
+        // Row holding the chore with choreId
+        bool rowOf(int choreId, Row& row) const {
+            auto found = rowsById.find(choreId);
+            if (found == rowsById.end()) {
+                return false;
+            }
+            row = found->second;
+            return true;
+        }
+
+        int getId(Row row) const { return ids[row]; }
+        int getEarnings(Row row) const { return earnings[row]; }
+        DIFFICULTY getDifficulty(Row row) const { return difficulties[row]; }
+        PRIORITY getPriority(Row row) const { return priorities[row]; }
+        STATUS getStatus(Row row) const { return statuses[row]; }
+        DayMask getDayMask(Row row) const { return dayMasks[row]; }
+        int getMinutes(Row row) const { return minutes[row]; }
+
+        // Whole columns, for callers running their own scans
+        const vector<int>& idColumn() const { return ids; }
+        const vector<int>& earningsColumn() const { return earnings; }
+        const vector<DIFFICULTY>& difficultyColumn() const { return difficulties; }
+        const vector<PRIORITY>& priorityColumn() const { return priorities; }
+        const vector<STATUS>& statusColumn() const { return statuses; }
+        const vector<DayMask>& dayMaskColumn() const { return dayMasks; }
+        const vector<int>& minutesColumn() const { return minutes; }
+
+        vector<Row> allRows() const {
+            vector<Row> rows(ids.size());
+            for (size_t i = 0; i < rows.size(); i++) {
+                rows[i] = static_cast<Row>(i);
+            }
+            return rows;
+        }
+
+        // Rows for which keep(row) is true
+        template<typename Predicate>
+        vector<Row> select(Predicate keep) const {
+            vector<Row> rows;
+            for (Row row = 0; row < ids.size(); row++) {
+                if (keep(row)) {
+                    rows.push_back(row);
+                }
+            }
+            return rows;
+        }
+
+        vector<Row> withStatus(STATUS status) const {
+            return select([this, status](Row row) { return statuses[row] == status; });
+        }
+
+        vector<Row> withDifficulty(DIFFICULTY difficulty) const {
+            return select([this, difficulty](Row row) { return difficulties[row] == difficulty; });
+        }
+
+        vector<Row> withPriority(PRIORITY priority) const {
+            return select([this, priority](Row row) { return priorities[row] == priority; });
+        }
+
+        vector<Row> dueOnAny(DayMask mask) const {
+            return select([this, mask](Row row) { return (dayMasks[row] & mask) != 0; });
+        }
+
+        void sortById(vector<Row>& rows, bool ascending = true) const { sortRows(rows, ids, ascending); }
+        void sortByEarnings(vector<Row>& rows, bool ascending = true) const { sortRows(rows, earnings, ascending); }
+        void sortByDifficulty(vector<Row>& rows, bool ascending = true) const { sortRows(rows, difficulties, ascending); }
+        void sortByPriority(vector<Row>& rows, bool ascending = true) const { sortRows(rows, priorities, ascending); }
+        void sortByStatus(vector<Row>& rows, bool ascending = true) const { sortRows(rows, statuses, ascending); }
+        void sortByMinutes(vector<Row>& rows, bool ascending = true) const { sortRows(rows, minutes, ascending); }
+
+        long long totalEarnings(const vector<Row>& rows) const {
+            long long total = 0;
+            for (Row row : rows) {
+                total += earnings[row];
+            }
+            return total;
+        }
+
+        long long totalEarnings() const {
+            long long total = 0;
+            for (int value : earnings) {
+                total += value;
+            }
+            return total;
+        }
+
+        long long totalMinutes(const vector<Row>& rows) const {
+            long long total = 0;
+            for (Row row : rows) {
+                total += minutes[row];
+            }
+            return total;
+        }
+
+        // Number of rows in each STATUS
+        std::array<size_t, 3> countByStatus() const {
+            std::array<size_t, 3> counts{};
+            for (STATUS status : statuses) {
+                counts[static_cast<size_t>(status)]++;
+            }
+            return counts;
+        }
+    };
+
+    //*********************************************************************************************************************
+    // create the ChoreManager class
+    class ChoreManager {
+    private:
+        json j;
+        vector<shared_ptr<Chore>> chores;
+        vector<shared_ptr<ChoreDoer>> doers;
+        wxString dynamicFile;
+        Client* client = nullptr;  // Initialize to nullptr to clearly indicate no client initially
+
+        // Shared repository state: frames borrow this one instance instead of re-reading the file
+        bool dirty = false;            // True when in-memory data differs from the data file
+        unsigned long version = 0;     // Bumped on every load and every change
+        shared_ptr<ChoreArena> arena = std::make_shared<ChoreArena>();   // Memory of the chores of the current load
+        ChoreTable table;              // Columnar copy of the chores, rebuilt when version moves past tableVersion
+        unsigned long tableVersion = static_cast<unsigned long>(-1);
+        ChoreArray choreArray;         // Chores by value, rebuilt when version moves past arrayVersion
+        unsigned long arrayVersion = static_cast<unsigned long>(-1);
+        time_t fileModTime = 0;        // Modification time of the data file when last loaded/saved
+        wxULongLong fileSize = 0;      // Size of the data file when last loaded/saved
+
+        // Write-ahead journal: mutations are appended to "<data file>.journal" as one
+        // compact JSON record per line and folded into the snapshot by a checkpoint
+        static const size_t JOURNAL_CHECKPOINT_BYTES = 1024 * 1024;  // Checkpoint once the journal grows past this
+        std::chrono::seconds checkpointInterval{ 60 };  // ... or on the first append this long after the last checkpoint
+        std::chrono::steady_clock::time_point lastCheckpoint = std::chrono::steady_clock::now();
+        bool journalMode = true;                  // Append mutations to the journal instead of rewriting the file
+        bool suppressJournal = false;             // Set while loading/replaying so nothing is journaled twice
+        unsigned long long journalSeq = 0;        // Sequence number of the last journal record
+        unsigned long long checkpointSeq = 0;     // Last sequence number folded into the snapshot
+        size_t journalBytes = 0;                  // Current journal size (guarded by journalMutex)
+        std::ofstream journalOut;                 // Open journal stream (guarded by journalMutex)
+        std::mutex journalMutex;
+        std::atomic<bool> checkpointPending{ false };   // A snapshot is queued or being written
+        std::atomic<bool> checkpointFailed{ false };
+        std::atomic<bool> fileRewritten{ false };       // A snapshot was written since the file stamp was taken
+        SNAPSHOT_FORMAT snapshotFormat = SNAPSHOT_FORMAT::JSON_COMPACT;   // Format used when writing the data file
+        std::atomic<bool> compressSnapshots{ false };    // zlib-compress the data file, shards and sealed journal; read by the writer thread
+        int compressionLevel = wxZ_DEFAULT_COMPRESSION;
+
+        // Sharded layout: the data file is a manifest and chores live in "<data file>.shards/chores-<n>.json",
+        // shard n holding ids n * shardSize to (n + 1) * shardSize - 1; 0 keeps every chore in the data file
+        static constexpr size_t DEFAULT_SHARD_SIZE = 256;
+        size_t shardSize = 0;
+        bool allShardsDirty = false;   // Rewrite every shard on the next save, not only those with changed chores
+        std::set<size_t> dirtyShards;  // Shards that lost a chore, rewritten on the next save
+        // With LOAD_MODE::LAZY a shard is read only once a chore in its id range is needed; these are the
+        // manifest entries of the shards not read yet, by shard number
+        std::map<size_t, json> unloadedShards;
+
+        // Log-structured layout: the data file is a manifest and chores live in a ChoreLogStore in
+        // "<data file>.store"; each save appends just the chores changed since the last one
+        std::unique_ptr<ChoreLogStore> logStore;
+        std::set<int> unreadStoreIds;   // With LOAD_MODE::LAZY, ids of the store's chores not read yet
+
+        // Lazy loading: while lazy is set, chores is empty and lazyIndex describes every chore in the file
+        LOAD_MODE loadMode;
+        bool lazy = false;
+        vector<ChoreIndexEntry> lazyIndex;
+        std::unordered_map<int, size_t> lazyById;   // Chore id -> position in lazyIndex
+        bool staleIndex = false;                    // An entry no longer matched the file; reload before trusting it
+
+        // Chores the user saved to their personal list, kept next to the data file so each user partition has its own;
+        // only the shared data file imports the old appended UserChoreList.json from the working directory
+        PersonalChoreList personalList{ siblingFile("UserChoreList.jsonl"),
+            wxFileName(dynamicFile).SameAs(wxFileName(DATA_FILE_PATH + "data.json")) ? wxString("UserChoreList.json") : wxString() };
+
+        // Listeners told which chores an external edit of the data file added, changed or removed
+        vector<std::pair<int, std::function<void(int choreId, CHORE_EVENT event)>>> listeners;
+        int nextListener = 0;
+
+        // File system watcher on the data file's directory; its events arrive through watchEvents and
+        // are coalesced by watchTimer so a burst of writes is merged once
+        wxEvtHandler watchEvents;
+        wxTimer watchTimer{ &watchEvents };
+        std::unique_ptr<wxFileSystemWatcher> watcher;
+
+        // Dedicated writer thread; declared after everything its callback touches
+        SnapshotWriter writer{ dynamicFile, [this](unsigned long long seq, bool ok) { onSnapshotWritten(seq, ok); } };
+
+        // A file in the data file's directory
+        wxString siblingFile(const wxString& name) const {
+            wxFileName fn(dynamicFile);
+            fn.SetFullName(name);
+            return fn.GetFullPath();
+        }
+
+        // Remember the data file's current timestamp and size
+        void refreshFileStamp() {
+            wxFileName fn(dynamicFile);
+            if (fn.FileExists()) {
+                fileModTime = fn.GetModificationTime().GetTicks();
+                fileSize = fn.GetSize();
+            }
+            else {
+                fileModTime = 0;
+                fileSize = 0;
+            }
+        }
+
+        wxString journalFile() const {
+            return dynamicFile + ".journal";
+        }
+
+        // Records carried over by a journal compaction while compression is on, as one zlib stream;
+        // replayed before the plain journal, which new records keep being appended to one line at a time
+        wxString sealedJournalFile() const {
+            return dynamicFile + ".journal.z";
+        }
+
+        // Every journal record line, sealed segment first; activeBytes is the size of the plain journal
+        std::string readJournal(size_t& activeBytes) const {
+            std::string contents;
+            std::ifstream sealed(sealedJournalFile().ToStdString(), std::ios::binary);
+            if (sealed) {
+                std::string compressed((std::istreambuf_iterator<char>(sealed)), std::istreambuf_iterator<char>());
+                if (!decompressSnapshot(compressed.data(), compressed.size(), contents)) {
+                    wxLogWarning("Ignoring unreadable journal segment %s", sealedJournalFile());
+                    contents.clear();
+                }
+            }
+            std::ifstream in(journalFile().ToStdString(), std::ios::binary);
+            std::string active((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+            activeBytes = active.size();
+            contents += active;
+            return contents;
+        }
+
+        wxString indexFile() const {
+            return dynamicFile + ".idx";
+        }
+
+        // Build the chore index of a text JSON data file, reusing "<data file>.idx" when it matches the file
+        // Returns false if the file cannot be indexed; the caller then loads it eagerly
+        bool loadIndex(const char* data, size_t size) {
+            wxFileName fn(dynamicFile);
+            long long modTime = fn.GetModificationTime().GetValue().GetValue();  // Milliseconds
+            size_t choresBegin = 0;
+            size_t choresEnd = 0;
+            lazyIndex.clear();
+            lazyById.clear();
+
+            bool fromSidecar = false;
+            std::ifstream idxIn(indexFile().ToStdString(), std::ios::binary);
+            if (idxIn) {
+                json idx = json::parse(idxIn, nullptr, false);
+                if (!idx.is_discarded() && idx.value("size", 0ULL) == size && idx.value("mtime", 0LL) == modTime) {
+                    choresBegin = idx.value("chores_begin", size_t(0));
+                    choresEnd = idx.value("chores_end", size_t(0));
+                    for (const auto& e : idx["entries"]) {
+                        lazyIndex.push_back({ e[0].get<int>(), wxString(e[1].get<std::string>()), e[2].get<size_t>(), e[3].get<size_t>(), nullptr });
+                    }
+                    fromSidecar = true;
+                }
+            }
+
+            if (!fromSidecar) {
+                ChoreIndexScanner scanner(data, size);
+                if (!scanner.scan(lazyIndex)) {
+                    lazyIndex.clear();
+                    return false;
+                }
+                choresBegin = scanner.choresBegin;
+                choresEnd = scanner.choresEnd;
+
+                json entries = json::array();
+                for (const auto& entry : lazyIndex) {
+                    entries.push_back({ entry.id, entry.name.ToStdString(), entry.offset, entry.length });
+                }
+                std::ofstream idxOut(indexFile().ToStdString(), std::ios::trunc | std::ios::binary);
+                idxOut << json{ {"size", size}, {"mtime", modTime}, {"chores_begin", choresBegin}, {"chores_end", choresEnd}, {"entries", entries} }.dump();
+            }
+
+            // Everything except the chores array is small: parse it with the array cut out
+            std::string rest = choresEnd > choresBegin
+                ? std::string(data, choresBegin) + "[]" + std::string(data + choresEnd, size - choresEnd)
+                : std::string(data, size);
+            j = json::parse(rest, nullptr, false);
+            if (j.is_discarded() || !j.is_object()) {
+                lazyIndex.clear();
+                return false;
+            }
+            j.erase("chores");
+            for (size_t i = 0; i < lazyIndex.size(); i++) {
+                lazyById[lazyIndex[i].id] = i;
+            }
+            lazy = true;
+            return true;
+        }
+
+        // Read and build the full Chore for one index entry
+        shared_ptr<Chore> materialize(ChoreIndexEntry& entry) {
+            if (entry.chore || entry.length == 0) {
+                return entry.chore;
+            }
+            flush();  // The index may already point into a snapshot that is still queued
+            std::ifstream file(dynamicFile.ToStdString(), std::ios::binary);
+            std::string bytes(entry.length, '\0');
+            if (!file.seekg(static_cast<std::streamoff>(entry.offset)) || !file.read(&bytes[0], static_cast<std::streamsize>(entry.length))) {
+                wxLogError("Error reading chore %d from %s", entry.id, dynamicFile);
+                return nullptr;
+            }
+            ChoreIndexEntry local = entry;
+            local.offset = 0;
+            json choreJson = ChoreIndexScanner::matches(local, bytes.data(), bytes.size()) ? json::parse(bytes, nullptr, false) : json();
+            if (!choreJson.is_object()) {
+                onStaleIndex(entry.id);
+                return nullptr;
+            }
+            entry.chore = makeChore(choreJson);
+            return entry.chore;
+        }
+
+        // Check every entry not built yet against the data file; false (and the index marked stale) on the first mismatch
+        bool indexMatchesFile() {
+            MappedFile mapped(dynamicFile);
+            if (!mapped.isOpen()) {
+                return true;  // Entries are then read one at a time by materialize, which checks them itself
+            }
+            for (const auto& entry : lazyIndex) {
+                if (!entry.chore && !ChoreIndexScanner::matches(entry, mapped.getData(), mapped.getSize())) {
+                    onStaleIndex(entry.id);
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Never hand out a chore read through an index that no longer describes the file
+        void onStaleIndex(int choreId) {
+            if (!staleIndex) {
+                wxLogWarning("Chore %d is no longer where the index of %s says; reloading the file.", choreId, dynamicFile);
+            }
+            staleIndex = true;
+            wxRemoveFile(indexFile());
+        }
+
+        // Reload after a stale index was found, rescanning the file; true if it reloaded
+        bool reloadStaleIndex() {
+            if (!staleIndex) {
+                return false;
+            }
+            staleIndex = false;
+            mergeFromDisk();
+            return true;
+        }
+
+        // Leave lazy mode: build every chore that has not been used yet, and read every shard not read yet
+        void materializeAll() {
+            readAllPending();
+            if (!lazy) {
+                return;
+            }
+            flush();
+            // Check the whole index before building anything, so a stale one is replaced while still lazy
+            if (!indexMatchesFile()) {
+                reloadStaleIndex();
+                materializeAll();
+                return;
+            }
+            MappedFile mapped(dynamicFile);
+            chores.clear();
+            chores.reserve(lazyIndex.size());
+            for (auto& entry : lazyIndex) {
+                if (!entry.chore && mapped.isOpen()) {
+                    json choreJson = json::parse(mapped.getData() + entry.offset, mapped.getData() + entry.offset + entry.length, nullptr, false);
+                    if (!choreJson.is_discarded()) {
+                        entry.chore = makeChore(choreJson, arena);
+                    }
+                }
+                if (!entry.chore) {
+                    entry.chore = materialize(entry);
+                }
+                if (entry.chore) {
+                    chores.push_back(entry.chore);
+                }
+            }
+            lazyIndex.clear();
+            lazyById.clear();
+            lazy = false;
+        }
+
+        // Decode a record of the data file for a reader, with the same fallback as makeChore but not wired to
+        // this manager; nullptr if the record cannot be read at all
+        static shared_ptr<Chore> decodeChore(const char* data, size_t length) {
+            json choreJson = json::parse(data, data + length, nullptr, false);
+            if (choreJson.is_discarded()) {
+                return nullptr;
+            }
+            if (shared_ptr<Chore> chore = Chore::fromCurrentSchema(choreJson)) {
+                return chore;
+            }
+            try {
+                return Chore::fromJSON(choreJson);
+            }
+            catch (const json::exception&) {
+                return nullptr;
+            }
+        }
+
+        // Call visit with every chore in file order. In lazy mode unbuilt chores are decoded one at a time from the
+        // file and dropped after the call, so nothing is materialized; records that cannot be read are skipped
+        // with a warning
+        void visitAllChores(const std::function<void(const Chore&)>& visit) {
+            readAllPending();
+            if (!lazy) {
+                for (const auto& chore : chores) {
+                    visit(*chore);
+                }
+                return;
+            }
+            flush();  // Index offsets must describe the file on disk
+            if (!indexMatchesFile()) {
+                reloadStaleIndex();
+                visitAllChores(visit);
+                return;
+            }
+            MappedFile mapped(dynamicFile);
+            if (!mapped.isOpen()) {
+                materializeAll();
+                visitAllChores(visit);
+                return;
+            }
+            size_t skipped = 0;
+            for (const auto& entry : lazyIndex) {
+                if (entry.chore) {
+                    visit(*entry.chore);
+                }
+                else if (shared_ptr<Chore> chore = decodeChore(mapped.getData() + entry.offset, entry.length)) {
+                    visit(*chore);
+                }
+                else {
+                    skipped++;
+                }
+            }
+            if (skipped > 0) {
+                wxLogWarning("Skipped %zu unreadable chores in %s", skipped, dynamicFile);
+            }
+        }
+
+        // Create a chore wired to report its changes back to this manager. Only bulk loads pass an arena; chores
+        // made one at a time (added, edited, synced, replayed or read on demand) go on the heap
+        shared_ptr<Chore> makeChore(const json& choreJson, const shared_ptr<ChoreArena>& in = nullptr) {
+            shared_ptr<Chore> chore = Chore::fromCurrentSchema(choreJson, in);
+            return adoptChore(chore ? chore : Chore::fromJSON(choreJson, in));
+        }
+
+        wxString shardDirectory() const {
+            return dynamicFile + ".shards";
+        }
+
+        static wxString shardFileName(size_t shard) {
+            return wxString::Format("chores-%lu.json", static_cast<unsigned long>(shard));
+        }
+
+        size_t shardOf(int choreId) const {
+            return choreId < 0 ? 0 : static_cast<size_t>(choreId) / shardSize;
+        }
+
+        // Parse one shard file into chores; runs on a loader thread, so errors are returned instead of shown
+        static bool loadShardFile(const wxString& file, vector<shared_ptr<Chore>>& loaded, std::string& error) {
+            MappedFile mapped(file);
+            std::string contents;
+            const char* data = mapped.getData();
+            size_t size = mapped.getSize();
+            if (!mapped.isOpen()) {
+                std::ifstream in(file.ToStdString(), std::ios::binary);
+                if (!in) {
+                    error = "Error opening file: " + file.ToStdString();
+                    return false;
+                }
+                contents.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+                data = contents.data();
+                size = contents.size();
+            }
+            std::string inflated;
+            if (isCompressedSnapshot(data, size)) {
+                if (!decompressSnapshot(data, size, inflated)) {
+                    error = "Error decompressing file: " + file.ToStdString();
+                    return false;
+                }
+                data = inflated.data();
+                size = inflated.size();
+            }
+            // Each shard has its own arena, so the loader threads never contend for one
+            ChoreSaxLoader loader([&loaded](shared_ptr<Chore> chore) { loaded.push_back(chore); }, std::make_shared<ChoreArena>());
+            if (!parseSnapshotSax(data, size, loader)) {
+                error = file.ToStdString() + ": " + loader.getError();
+                loaded.clear();
+                return false;
+            }
+            return true;
+        }
+
+        // Load the shards listed in the manifest, or with LOAD_MODE::LAZY just remember them for loadShardOf
+        void loadShards() {
+            shardSize = std::max<size_t>(j.value("shard_size", DEFAULT_SHARD_SIZE), 1);
+            json manifest = j["shards"];
+            j.erase("shards");
+            j.erase("shard_size");
+
+            vector<json> entries;
+            for (auto& shard : manifest) {
+                if (loadMode == LOAD_MODE::LAZY && shard.contains("first_id")) {
+                    size_t number = shardOf(shard["first_id"].get<int>());
+                    unloadedShards[number] = std::move(shard);
+                }
+                else {
+                    entries.push_back(std::move(shard));
+                }
+            }
+            readShards(entries);
+        }
+
+        // Read the shard holding choreId, or the chore itself from the log store, if it has not been read yet
+        void readPending(int choreId) {
+            if (unreadStoreIds.erase(choreId) > 0) {
+                readStoredChore(choreId);
+            }
+            if (unloadedShards.empty()) {
+                return;
+            }
+            auto found = unloadedShards.find(shardOf(choreId));
+            if (found == unloadedShards.end()) {
+                return;
+            }
+            vector<json> entries{ std::move(found->second) };
+            unloadedShards.erase(found);
+            readShards(entries);
+        }
+
+        // Read every shard and log-store chore not read yet, for operations that need all chores
+        void readAllPending() {
+            if (!unreadStoreIds.empty()) {
+                logStore->forEach([this](int id, std::string_view chore) {
+                    if (unreadStoreIds.count(id) > 0) {
+                        adoptStoredChore(id, chore, arena);
+                    }
+                    });
+                unreadStoreIds.clear();
+            }
+            if (unloadedShards.empty()) {
+                return;
+            }
+            vector<json> entries;
+            for (auto& shard : unloadedShards) {
+                entries.push_back(std::move(shard.second));
+            }
+            unloadedShards.clear();
+            readShards(entries);
+        }
+
+        // Read shard files given by their manifest entries, independent shards in parallel
+        void readShards(const vector<json>& entries) {
+            vector<wxString> files;
+            for (const auto& shard : entries) {
+                files.push_back(shardDirectory() + wxFileName::GetPathSeparator() + wxString(shard.value("file", "")));
+            }
+            vector<vector<shared_ptr<Chore>>> loaded(files.size());
+            vector<std::string> errors(files.size());
+            std::atomic<size_t> next{ 0 };
+            size_t threadCount = std::min<size_t>(files.size(), std::max(1u, std::thread::hardware_concurrency()));
+            vector<std::thread> loaders;
+            for (size_t t = 0; t < threadCount; t++) {
+                loaders.emplace_back([&]() {
+                    for (size_t i = next++; i < files.size(); i = next++) {
+                        loadShardFile(files[i], loaded[i], errors[i]);
+                    }
+                });
+            }
+            for (auto& loader : loaders) {
+                loader.join();
+            }
+
+            // Callbacks are wired on this thread, in manifest order
+            for (size_t i = 0; i < files.size(); i++) {
+                if (!errors[i].empty()) {
+                    showError("Shard Error: " + wxString(errors[i]), "File Error");
+                }
+                for (auto& chore : loaded[i]) {
+                    chore->markSaved();
+                    chores.push_back(adoptChore(chore));
+                }
+            }
+        }
+
+        wxString logStoreDirectory() const {
+            return dynamicFile + ".store";
+        }
+
+        // Open the log store; with LOAD_MODE::LAZY chores are read one at a time as they are needed
+        void loadLogStore() {
+            logStore = std::make_unique<ChoreLogStore>(logStoreDirectory());
+            if (loadMode == LOAD_MODE::LAZY) {
+                vector<int> ids = logStore->ids();
+                unreadStoreIds.insert(ids.begin(), ids.end());
+                return;
+            }
+            chores.reserve(logStore->size());
+            logStore->forEach([this](int id, std::string_view chore) { adoptStoredChore(id, chore, arena); });
+        }
+
+        // Read one chore from the log store with a single positioned read
+        void readStoredChore(int choreId) {
+            std::string chore;
+            if (!logStore->get(choreId, chore)) {
+                wxLogError("Error reading chore %d from %s", choreId, logStoreDirectory());
+                return;
+            }
+            adoptStoredChore(choreId, chore);
+        }
+
+        void adoptStoredChore(int id, std::string_view chore, const shared_ptr<ChoreArena>& in = nullptr) {
+            json choreJson = json::parse(chore, nullptr, false);
+            if (choreJson.is_discarded()) {
+                wxLogError("Ignoring unreadable chore %d in %s", id, logStoreDirectory());
+                return;
+            }
+            chores.push_back(makeChore(choreJson, in));
+            chores.back()->markSaved();
+        }
+
+        // Append every chore changed since the last save to the log store and serialize the manifest;
+        // returns false if the store could not be written, leaving the changes for the next save
+        bool serializeStoreManifest(std::string& manifest) {
+            bool ok = true;
+            vector<Chore*> written;
+            for (const auto& chore : chores) {
+                if (!chore->isDirty()) {
+                    continue;
+                }
+                if (!logStore->put(chore->getId(), chore->getSerialized(SNAPSHOT_FORMAT::JSON_COMPACT))) {
+                    ok = false;
+                    break;
+                }
+                written.push_back(chore.get());
+            }
+            if (!ok || !logStore->sync()) {
+                return false;
+            }
+            // Only records that reached the store are clean; a failed put leaves the rest for the next save
+            for (Chore* chore : written) {
+                chore->markSaved();
+            }
+            json head = buildSnapshotHead();
+            head["store"] = "log";
+            manifest = serializeSnapshot(head, snapshotFormat);
+            return true;
+        }
+
+        // Wire an already built chore to report its changes back to this manager
+        shared_ptr<Chore> adoptChore(shared_ptr<Chore> chore) {
+            Chore* raw = chore.get();
+            chore->setUpdateCallback([this, raw](CHANGE change) { onChoreChanged(*raw, change); });
+            return chore;
+        }
+
+        shared_ptr<Chore> findChoreById(int choreId) {
+            if (lazy) {
+                auto found = lazyById.find(choreId);
+                return found != lazyById.end() ? materialize(lazyIndex[found->second]) : nullptr;
+            }
+            readPending(choreId);
+            auto it = find_if(chores.begin(), chores.end(), [choreId](const shared_ptr<Chore>& c) {
+                return c->getId() == choreId;
+                });
+            return it != chores.end() ? *it : nullptr;
+        }
+
+        // Called by a chore whenever one of its fields or its status changes
+        void onChoreChanged(const Chore& chore, CHANGE change) {
+            markDirty();
+            if (change == CHANGE::STATUS) {
+                appendJournal({ {"op", "status"}, {"id", chore.getId()}, {"status", chore.getStatusString()} });
+            }
+            else {
+                appendJournal({ {"op", "modify"}, {"id", chore.getId()}, {"chore", chore.toJSON()} });
+            }
+        }
+
+        // Append one mutation record to the journal; triggers a checkpoint when the journal gets large
+        void appendJournal(json record) {
+            if (!journalMode || suppressJournal) {
+                return;
+            }
+            record["seq"] = ++journalSeq;
+            std::string line = record.dump() + "\n";
+            bool needCheckpoint = false;
+            {
+                std::lock_guard<std::mutex> lock(journalMutex);
+                if (!journalOut.is_open()) {
+                    journalOut.open(journalFile().ToStdString(), std::ios::app | std::ios::binary);
+                }
+                journalOut << line;
+                journalOut.flush();
+                if (!journalOut) {
+                    wxLogError("Error writing journal: %s", journalFile());
+                    journalOut.clear();
+                }
+                journalBytes += line.size();
+                // Either bound keeps the replay after a crash short
+                needCheckpoint = journalBytes >= JOURNAL_CHECKPOINT_BYTES || std::chrono::steady_clock::now() - lastCheckpoint >= checkpointInterval;
+            }
+            if (needCheckpoint && !checkpointPending) {
+                checkpoint();
+            }
+        }
+
+        // Drop journal records already contained in the snapshot (seq <= uptoSeq) and any torn lines. With
+        // compression on, the records kept are sealed into the compressed segment and the plain journal restarts empty
+        void compactJournal(unsigned long long uptoSeq) {
+            std::lock_guard<std::mutex> lock(journalMutex);
+            journalOut.close();
+            size_t activeBytes = 0;
+            std::istringstream in(readJournal(activeBytes));
+            std::string keep;
+            std::string line;
+            while (std::getline(in, line)) {
+                json record = json::parse(line, nullptr, false);
+                if (!record.is_discarded() && record.value("seq", 0ULL) > uptoSeq) {
+                    keep += line + "\n";
+                }
+            }
+            bool seal = compressSnapshots && !keep.empty();
+            if (seal && !writeFileAtomically(sealedJournalFile(), compressSnapshot(keep, compressionLevel))) {
+                wxLogError("Error writing journal segment: %s", sealedJournalFile());
+                seal = false;
+            }
+            std::ofstream out(journalFile().ToStdString(), std::ios::trunc | std::ios::binary);
+            journalBytes = 0;
+            if (!seal) {
+                out << keep;
+                journalBytes = keep.size();
+            }
+            out.close();
+            // Removed only once its records are in the plain journal; replay skips any it then sees twice
+            if (!seal && wxFileExists(sealedJournalFile())) {
+                wxRemoveFile(sealedJournalFile());
+            }
+            journalOut.open(journalFile().ToStdString(), std::ios::app | std::ios::binary);
+        }
+
+        // Re-apply journal records newer than the snapshot after loading it. Records are parsed in parallel and
+        // folded per chore id, so a chore changed many times since the checkpoint is built once, and the final
+        // states of the independent chores are built on a thread pool. Lazy loads stay lazy: only chores with
+        // a status record and no full record are materialized. Doer, assignment and profile records follow in order.
+        void replayJournal() {
+            journalSeq = checkpointSeq;
+            {
+                std::lock_guard<std::mutex> lock(journalMutex);
+                journalBytes = 0;
+            }
+            size_t activeBytes = 0;
+            std::string contents = readJournal(activeBytes);
+            if (contents.empty()) {
+                return;
+            }
+            vector<std::string_view> lines;
+            for (size_t pos = 0; pos < contents.size();) {
+                size_t end = contents.find('\n', pos);
+                if (end == std::string::npos) {
+                    end = contents.size();
+                }
+                if (end > pos) {
+                    lines.emplace_back(contents.data() + pos, end - pos);
+                }
+                pos = end + 1;
+            }
+            vector<json> records(lines.size());
+            parallelFor(lines.size(), [&](size_t i) { records[i] = json::parse(lines[i], nullptr, false); });
+
+            // Final state of every chore the journal touches
+            struct ChoreReplay {
+                json chore;                         // Full chore, when the journal has one
+                json status;                        // Latest status record for a chore only the snapshot holds
+                bool removed = false;               // Removed by the last record
+                bool erased = false;                // Removed at some point, so a later copy goes to the end
+                unsigned long long createdSeq = 0;  // Record that (re)created the chore, ordering appended chores
+                shared_ptr<Chore> built;
+            };
+            std::unordered_map<int, ChoreReplay> folded;
+            vector<int> order;              // Chore ids in order of first appearance
+            vector<const json*> others;
+            size_t applied = 0;
+            bool torn = false;
+            for (auto& record : records) {
+                if (record.is_discarded()) {
+                    // A crash during an append leaves a partial last line
+                    wxLogWarning("Ignoring incomplete journal record in %s", journalFile());
+                    torn = true;
+                    break;
+                }
+                unsigned long long seq = record.value("seq", 0ULL);
+                if (seq <= journalSeq) {
+                    continue;  // In the snapshot already, or repeated by a compaction cut short
+                }
+                journalSeq = seq;
+                applied++;
+                std::string op = record.value("op", "");
+                if (op != "add" && op != "modify" && op != "status" && op != "remove") {
+                    others.push_back(&record);
+                    continue;
+                }
+                int choreId = op == "add" ? record["chore"].value("id", -1) : record.value("id", -1);
+                auto inserted = folded.try_emplace(choreId);
+                if (inserted.second) {
+                    order.push_back(choreId);
+                }
+                ChoreReplay& replay = inserted.first->second;
+                if (op == "remove") {
+                    replay = ChoreReplay();
+                    replay.removed = true;
+                    replay.erased = true;
+                }
+                else if (op == "status") {
+                    if (replay.chore.is_object()) {
+                        replay.chore["status"] = record["status"];
+                    }
+                    else if (!replay.removed) {
+                        replay.status = std::move(record);
+                    }
+                }
+                else {
+                    bool erased = replay.erased;
+                    unsigned long long createdSeq = inserted.second || replay.removed ? seq : replay.createdSeq;
+                    replay = ChoreReplay();
+                    replay.erased = erased;
+                    replay.createdSeq = createdSeq;
+                    replay.chore = std::move(record["chore"]);
+                }
+            }
+
+            vector<ChoreReplay*> toBuild;
+            for (int choreId : order) {
+                if (folded[choreId].chore.is_object()) {
+                    toBuild.push_back(&folded[choreId]);
+                }
+            }
+            // Built in runs of REPLAY_CHUNK chores, each with its own arena like the importer's chunks, so the
+            // workers never wait on one another's allocations
+            static constexpr size_t REPLAY_CHUNK = 1024;
+            parallelFor((toBuild.size() + REPLAY_CHUNK - 1) / REPLAY_CHUNK, [&](size_t run) {
+                shared_ptr<ChoreArena> runArena = std::make_shared<ChoreArena>();
+                size_t end = std::min(toBuild.size(), (run + 1) * REPLAY_CHUNK);
+                for (size_t i = run * REPLAY_CHUNK; i < end; i++) {
+                    try {
+                        shared_ptr<Chore> chore = Chore::fromCurrentSchema(toBuild[i]->chore, runArena);
+                        toBuild[i]->built = chore ? chore : Chore::fromJSON(toBuild[i]->chore, runArena);
+                    }
+                    catch (const json::exception&) {
+                        // Left unbuilt and reported below
+                    }
+                }
+                });
+
+            suppressJournal = true;
+            std::unordered_map<int, size_t> positions;   // Chore id -> index in chores, for eager loads
+            if (!lazy) {
+                for (int choreId : order) {
+                    readPending(choreId);  // Only the shards the journal touches are read
+                }
+                for (size_t i = 0; i < chores.size(); i++) {
+                    positions[chores[i]->getId()] = i;
+                }
+            }
+            // Chores the journal created or re-created go to the end in the order that happened, as in the app
+            // before the crash; every other chore keeps its place
+            vector<int> removed;
+            vector<ChoreReplay*> appended;
+            for (int choreId : order) {
+                ChoreReplay& replay = folded[choreId];
+                bool exists = lazy ? lazyById.count(choreId) > 0 : positions.count(choreId) > 0;
+                if (replay.erased && exists) {
+                    removed.push_back(choreId);  // After the replacements, as erasing shifts positions
+                }
+                if (replay.removed) {
+                    continue;
+                }
+                if (replay.built) {
+                    adoptChore(replay.built);
+                    if (!exists || replay.erased) {
+                        appended.push_back(&replay);
+                    }
+                    else if (lazy) {
+                        putChore(replay.built);
+                    }
+                    else {
+                        chores[positions[choreId]] = replay.built;
+                    }
+                }
+                else if (replay.chore.is_object()) {
+                    wxLogWarning("Ignoring unreadable journal record for chore %d", choreId);
+                }
+                else if (replay.status.is_object() && exists) {
+                    shared_ptr<Chore> chore = lazy ? findChoreById(choreId) : chores[positions[choreId]];
+                    if (chore) {
+                        chore->setStatusFromJSON(replay.status);
+                    }
+                }
+            }
+            for (int choreId : removed) {
+                eraseChore(choreId);
+            }
+            std::sort(appended.begin(), appended.end(), [](const ChoreReplay* a, const ChoreReplay* b) {
+                return a->createdSeq < b->createdSeq;
+                });
+            for (ChoreReplay* replay : appended) {
+                if (lazy) {
+                    putChore(replay->built);
+                }
+                else {
+                    chores.push_back(replay->built);
+                }
+            }
+            for (const json* record : others) {
+                applyJournalRecord(*record);
+            }
+            suppressJournal = false;
+
+            if (torn) {
+                compactJournal(checkpointSeq);
+            }
+            else {
+                std::lock_guard<std::mutex> lock(journalMutex);
+                journalBytes = activeBytes;
+            }
+            if (applied > 0) {
+                dirty = true;  // Snapshot is behind the journal until the next checkpoint
+            }
+        }
+
+        // Apply a single journal record to the in-memory state
+        void applyJournalRecord(const json& record) {
+            std::string op = record.value("op", "");
+            if (op == "add") {
+                putChore(makeChore(record["chore"]));  // The log store may already hold it
+            }
+            else if (op == "modify") {
+                int choreId = record.value("id", -1);
+                readPending(choreId);
+                auto it = find_if(chores.begin(), chores.end(), [choreId](const shared_ptr<Chore>& c) {
+                    return c->getId() == choreId;
+                    });
+                if (it != chores.end()) {
+                    *it = makeChore(record["chore"]);
+                }
+                else {
+                    chores.push_back(makeChore(record["chore"]));
+                }
+            }
+            else if (op == "status") {
+                auto chore = findChoreById(record.value("id", -1));
+                if (chore) {
+                    chore->setStatusFromJSON(record);
+                }
+            }
+            else if (op == "remove") {
+                eraseChore(record.value("id", -1));
+            }
+            else if (op == "doer") {
+                addChoreDoer(wxString(record.value("name", "")), record.value("age", 0));
+            }
+            else if (op == "assign") {
+                assignChoreDoer(record.value("id", -1), wxString(record.value("doer", "")));
+            }
+            else if (op == "profile") {
+                json profile = record["profile"];
+                setUserProfile(wxString(profile.value("username", "defaultUser")), wxString(profile.value("theme", "light")), profile.value("notify", false));
+            }
+            else if (op == "user") {
+                // Profiles written before they moved to ProfileStore; the store imports them from the snapshot
+            }
+            else {
+                wxLogWarning("Unknown journal operation: %s", op);
+            }
+        }
+
+        // Replace the chore with the same id, or add it
+        void putChore(const shared_ptr<Chore>& chore) {
+            if (lazy) {
+                auto found = lazyById.find(chore->getId());
+                if (found != lazyById.end()) {
+                    lazyIndex[found->second].name = chore->getName();
+                    lazyIndex[found->second].chore = chore;
+                }
+                else {
+                    lazyById[chore->getId()] = lazyIndex.size();
+                    lazyIndex.push_back({ chore->getId(), chore->getName(), 0, 0, chore });
+                }
+                version++;
+                return;
+            }
+            readPending(chore->getId());
+            auto it = find_if(chores.begin(), chores.end(), [&chore](const shared_ptr<Chore>& c) {
+                return c->getId() == chore->getId();
+                });
+            if (it != chores.end()) {
+                *it = chore;
+            }
+            else {
+                chores.push_back(chore);
+            }
+            version++;
+        }
+
+        bool eraseChore(int choreId) {
+            if (lazy) {
+                materializeAll();
+            }
+            readPending(choreId);
+            auto it = find_if(chores.begin(), chores.end(), [choreId](const shared_ptr<Chore>& c) {
+                return c->getId() == choreId;
+                });
+            if (it == chores.end()) {
+                return false;
+            }
+            chores.erase(it);
+            version++;
+            if (shardSize > 0) {
+                dirtyShards.insert(shardOf(choreId));  // The shard that held it has no dirty chore left to notice
+            }
+            if (logStore && !logStore->remove(choreId)) {
+                wxLogError("Error removing chore %d from %s", choreId, logStoreDirectory());
+            }
+            return true;
+        }
+
+        // Delta sync baseline "<data file>.syncbase": the chore records of what was last synced
+        wxString syncBaseFile() const {
+            return dynamicFile + ".syncbase";
+        }
+
+        // Compact JSON of every chore last synced, by id; lines counts the records in the file
+        std::unordered_map<int, std::string> loadSyncBase(size_t& lines) const {
+            std::unordered_map<int, std::string> base;
+            lines = 0;
+            std::ifstream in(syncBaseFile().ToStdString(), std::ios::binary);
+            std::string line;
+            while (std::getline(in, line)) {
+                int id;
+                std::string_view chore;
+                if (!splitChoreRecord(line, id, chore)) {
+                    continue;
+                }
+                if (chore.empty()) {
+                    base.erase(id);
+                }
+                else {
+                    base[id] = std::string(chore);
+                }
+                lines++;
+            }
+            return base;
+        }
+
+        // Append synced chores (an empty string for a removed one) to the baseline
+        bool appendSyncBase(const vector<std::pair<int, std::string>>& records) {
+            if (records.empty()) {
+                return true;
+            }
+            std::ofstream out(syncBaseFile().ToStdString(), std::ios::app | std::ios::binary);
+            for (const auto& record : records) {
+                out << makeChoreRecord(record.first, record.second);
+            }
+            out.flush();
+            if (!out) {
+                wxLogError("Error writing sync baseline: %s", syncBaseFile());
+                return false;
+            }
+            return true;
+        }
+
+        void notifyListeners(int choreId, CHORE_EVENT event) {
+            auto current = listeners;  // A listener may remove itself
+            for (const auto& listener : current) {
+                listener.second(choreId, event);
+            }
+        }
+
+        // Re-read the whole data file after an external edit (a full parse, not a patch) and reconcile the result
+        // with the chores in memory by id. Chore objects are kept: unchanged ones as they are, changed ones updated
+        // in place, so anything holding them stays valid, and listeners hear only about the chores that were added,
+        // changed or removed. Chores a lazy load never built are compared by name, the only thing shown of them.
+        // Sharded and log-store layouts are simply reloaded.
+        void mergeFromDisk() {
+            if (shardSize > 0 || logStore) {
+                loadData();
+                notifyListeners(-1, CHORE_EVENT::RELOADED);
+                return;
+            }
+            std::unordered_map<int, shared_ptr<Chore>> built;   // Chores that may be held elsewhere
+            std::unordered_map<int, wxString> names;
+            readAllPending();  // Names of the chores in shards not read yet are needed to tell what changed
+            if (lazy) {
+                for (const auto& entry : lazyIndex) {
+                    names[entry.id] = entry.name;
+                    if (entry.chore) {
+                        built[entry.id] = entry.chore;
+                    }
+                }
+            }
+            else {
+                for (const auto& chore : chores) {
+                    names[chore->getId()] = chore->getName();
+                    built[chore->getId()] = chore;
+                }
+            }
+
+            loadData();
+            readAllPending();
+            vector<std::pair<int, CHORE_EVENT>> events;
+            // Keep the old object for a chore, copying the reloaded state into it if it differs
+            auto reconcile = [&](shared_ptr<Chore>& fresh) {
+                auto old = built.find(fresh->getId());
+                if (old == built.end()) {
+                    return;
+                }
+                if (old->second->toJSON() != fresh->toJSON()) {
+                    events.emplace_back(old->first, CHORE_EVENT::CHANGED);
+                    if (!old->second->assign(*fresh)) {
+                        return;  // Its difficulty changed, so the reloaded object of the new class replaces it
+                    }
+                    adoptChore(old->second);
+                }
+                old->second->markSaved();
+                fresh = old->second;
+            };
+            auto visit = [&](int choreId, const wxString& name) {
+                auto previous = names.find(choreId);
+                if (previous == names.end()) {
+                    events.emplace_back(choreId, CHORE_EVENT::ADDED);
+                    return;
+                }
+                if (!built.count(choreId) && previous->second != name) {
+                    events.emplace_back(choreId, CHORE_EVENT::CHANGED);
+                }
+                names.erase(previous);
+            };
+            if (lazy) {
+                for (auto& entry : lazyIndex) {
+                    if (built.count(entry.id) && materialize(entry)) {
+                        reconcile(entry.chore);
+                    }
+                    visit(entry.id, entry.name);
+                }
+            }
+            else {
+                for (auto& chore : chores) {
+                    reconcile(chore);
+                    visit(chore->getId(), chore->getName());
+                }
+            }
+            for (const auto& removed : names) {
+                events.emplace_back(removed.first, CHORE_EVENT::REMOVED);
+            }
+            loadChoreDoers();  // Assign the kept objects again
+            for (const auto& event : events) {
+                notifyListeners(event.first, event.second);
+            }
+        }
+
+        // Everything in a snapshot except the chores array
+        json buildSnapshotHead() const {
+            json snapshot;
+            snapshot[SCHEMA_KEY] = SCHEMA_VERSION;
+            if (client) {
+                snapshot["user_profile"] = {
+                    {"username", client->getUsername().ToStdString()},
+                    {"theme", client->getTheme().ToStdString()},
+                    {"notify", client->getNotify()}
+                };
+            }
+
+            if (!doers.empty()) {
+                json doersJson = json::array();
+                for (const auto& doer : doers) {
+                    json assigned = json::array();
+                    for (const auto& chore : doer->assignedChores) {
+                        assigned.push_back(chore->getId());
+                    }
+                    doersJson.push_back({ {"name", doer->name}, {"age", doer->age}, {"assigned", assigned} });
+                }
+                snapshot["chore_doers"] = doersJson;
+            }
+            snapshot["journal_seq"] = journalSeq;
+            return snapshot;
+        }
+
+        // Split the encoded snapshot around its "chores" value, so the array can be written in between
+        void encodeSnapshotHead(SNAPSHOT_FORMAT format, std::string& prefix, std::string& suffix) const {
+            encodeAroundChores(buildSnapshotHead(), format, prefix, suffix);
+        }
+
+        static void encodeAroundChores(json head, SNAPSHOT_FORMAT format, std::string& prefix, std::string& suffix) {
+            const std::string placeholder = "\x01chores\x01";
+            head["chores"] = placeholder;
+            std::string doc = serializeSnapshot(head, format);
+            std::string marker;
+            if (format == SNAPSHOT_FORMAT::CBOR) {
+                json::to_cbor(json(placeholder), marker);
+            }
+            else if (format == SNAPSHOT_FORMAT::MSGPACK) {
+                json::to_msgpack(json(placeholder), marker);
+            }
+            else {
+                marker = json(placeholder).dump();
+            }
+            size_t at = doc.find(marker);
+            prefix = doc.substr(0, at);
+            suffix = doc.substr(at + marker.size());
+        }
+
+        // Start of an encoded array of count elements
+        static std::string encodeArrayHeader(SNAPSHOT_FORMAT format, size_t count) {
+            std::string out;
+            if (format == SNAPSHOT_FORMAT::JSON) {
+                out = count == 0 ? "[]" : "[\n";
+            }
+            else if (format == SNAPSHOT_FORMAT::JSON_COMPACT) {
+                out = "[";
+            }
+            else if (format == SNAPSHOT_FORMAT::CBOR) {
+                // Array header, major type 4
+                if (count < 24) {
+                    out += static_cast<char>(0x80 + count);
+                }
+                else {
+                    int width = count <= 0xff ? 1 : count <= 0xffff ? 2 : count <= 0xffffffffULL ? 4 : 8;
+                    out += static_cast<char>(width == 1 ? 0x98 : width == 2 ? 0x99 : width == 4 ? 0x9a : 0x9b);
+                    for (int shift = (width - 1) * 8; shift >= 0; shift -= 8) {
+                        out += static_cast<char>((static_cast<unsigned long long>(count) >> shift) & 0xff);
+                    }
+                }
+            }
+            else {
+                // MessagePack fixarray, array16 or array32
+                if (count < 16) {
+                    out += static_cast<char>(0x90 + count);
+                }
+                else {
+                    int width = count <= 0xffff ? 2 : 4;
+                    out += static_cast<char>(width == 2 ? 0xdc : 0xdd);
+                    for (int shift = (width - 1) * 8; shift >= 0; shift -= 8) {
+                        out += static_cast<char>((count >> shift) & 0xff);
+                    }
+                }
+            }
+            return out;
+        }
+
+        // Separator written before element i, and the end of a text array
+        static const char* arraySeparator(SNAPSHOT_FORMAT format, size_t i) {
+            if (i == 0 || !isTextFormat(format)) {
+                return "";
+            }
+            return format == SNAPSHOT_FORMAT::JSON ? ",\n" : ",";
+        }
+
+        static const char* arrayFooter(SNAPSHOT_FORMAT format, size_t count) {
+            if (format == SNAPSHOT_FORMAT::JSON_COMPACT) {
+                return "]";
+            }
+            return format == SNAPSHOT_FORMAT::JSON && count > 0 ? "\n    ]" : "";
+        }
+
+        // Serialize the snapshot, re-encoding only chores that changed since the last save: cached fragments
+        // of unchanged chores are shared with the payload as they are, and in lazy mode chores never
+        // materialized are copied from the current file (minified when writing compact JSON) while the
+        // writer streams it, so the document is never held in memory as a whole
+        SnapshotPayload serializeState() {
+            std::shared_ptr<MappedFile> mapped;
+            if (lazy) {
+                flush();  // Index offsets must describe the file on disk
+                mapped = std::make_shared<MappedFile>(dynamicFile);
+                // Index offsets cannot point into a compressed file
+                if (!isTextFormat(snapshotFormat) || compressSnapshots || !mapped->isOpen()) {
+                    materializeAll();
+                }
+            }
+            size_t count = lazy ? lazyIndex.size() : chores.size();
+            // Raw bytes are copied only if every entry still matches, before any offset is moved
+            if (lazy) {
+                for (const auto& entry : lazyIndex) {
+                    if (!entry.chore && !ChoreIndexScanner::matches(entry, mapped->getData(), mapped->getSize())) {
+                        onStaleIndex(entry.id);
+                        return SnapshotPayload();  // Copying those bytes would corrupt the file; reloadIfChanged rescans it
+                    }
+                }
+            }
+
+            std::string prefix, suffix;
+            encodeSnapshotHead(snapshotFormat, prefix, suffix);
+            SnapshotPayload payload;
+            payload.append(prefix);
+            payload.append(encodeArrayHeader(snapshotFormat, count));
+            for (size_t i = 0; i < count; i++) {
+                payload.append(arraySeparator(snapshotFormat, i));
+                if (lazy && !lazyIndex[i].chore) {
+                    // Chores still only indexed now live at their new place in the file being written
+                    ChoreIndexEntry& entry = lazyIndex[i];
+                    const char* raw = mapped->getData() + entry.offset;
+                    if (snapshotFormat == SNAPSHOT_FORMAT::JSON) {
+                        payload.append("        ");
+                    }
+                    entry.offset = payload.size();
+                    payload.appendRaw(raw, entry.length, snapshotFormat == SNAPSHOT_FORMAT::JSON_COMPACT);
+                    entry.length = payload.size() - entry.offset;
+                }
+                else {
+                    Chore& chore = lazy ? *lazyIndex[i].chore : *chores[i];
+                    payload.append(chore.getSerializedFragment(snapshotFormat));
+                    chore.markSaved();  // A failed write sets checkpointFailed, and the journal still holds the change
+                }
+            }
+            payload.append(arrayFooter(snapshotFormat, count));
+            payload.append(suffix);
+            payload.keepSource(mapped);
+            return payload;
+        }
+
+        // Serialize the manifest, and into shardFiles every shard holding a chore changed since the last save
+        std::string serializeShards(std::map<wxString, std::string>& shardFiles) {
+            if (allShardsDirty) {
+                readAllPending();  // Every shard file is rewritten, including those not read yet
+            }
+            if (!wxDirExists(shardDirectory())) {
+                wxFileName::Mkdir(shardDirectory(), wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL);
+            }
+            std::map<size_t, vector<Chore*>> shards;
+            for (const auto& chore : chores) {
+                shards[shardOf(chore->getId())].push_back(chore.get());
+            }
+
+            std::string prefix, suffix;
+            encodeAroundChores(json{ {SCHEMA_KEY, SCHEMA_VERSION} }, snapshotFormat, prefix, suffix);
+            std::map<size_t, json> entries = unloadedShards;   // Shards not read yet are unchanged on disk
+            for (const auto& [shard, members] : shards) {
+                wxString name = shardFileName(shard);
+                entries[shard] = { {"file", name.ToStdString()}, {"first_id", shard * shardSize}, {"last_id", (shard + 1) * shardSize - 1}, {"count", members.size()} };
+                bool changed = allShardsDirty || dirtyShards.count(shard) > 0 || std::any_of(members.begin(), members.end(), [](const Chore* chore) { return chore->isDirty(); });
+                if (!changed) {
+                    continue;
+                }
+                std::string doc = prefix + encodeArrayHeader(snapshotFormat, members.size());
+                for (size_t i = 0; i < members.size(); i++) {
+                    doc += arraySeparator(snapshotFormat, i);
+                    doc += members[i]->getSerialized(snapshotFormat);
+                    members[i]->markSaved();  // A failed shard write re-dirties every shard in flush()
+                }
+                doc += arrayFooter(snapshotFormat, members.size());
+                doc += suffix;
+                shardFiles[shardDirectory() + wxFileName::GetPathSeparator() + name] = std::move(doc);
+            }
+            allShardsDirty = false;
+            dirtyShards.clear();
+            json manifest = json::array();
+            for (auto& entry : entries) {
+                manifest.push_back(std::move(entry.second));
+            }
+
+            json head = buildSnapshotHead();
+            head["shard_size"] = shardSize;
+            head["shards"] = manifest;
+            return serializeSnapshot(head, snapshotFormat);
+        }
+
+        // Rewrite the data file in the current schema if it was written by an older version. Chores are decoded
+        // by the tolerant SAX loader one at a time, as their difficulty's class and with any keys it does not read,
+        // and appended to a temporary file, so memory does not grow with the number of chores; the file itself is
+        // copied to "<data file>.v<old version>.bak", unmapped and replaced once everything is written.
+        // Returns true if the file was upgraded.
+        bool upgradeSchema() {
+            wxString bodyPath = dynamicFile + ".migrate";
+            size_t count = 0;
+            int fromVersion = SCHEMA_VERSION;
+            SNAPSHOT_FORMAT format;
+            json head;
+            {
+                MappedFile mapped(dynamicFile);
+                if (!mapped.isOpen()) {
+                    return false;  // loadData reports missing files
+                }
+                const char* data = mapped.getData();
+                size_t size = mapped.getSize();
+                std::string inflated;
+                if (isCompressedSnapshot(data, size)) {
+                    if (!decompressSnapshot(data, size, inflated)) {
+                        return false;
+                    }
+                    data = inflated.data();
+                    size = inflated.size();
+                }
+                compressSnapshots = isCompressedSnapshot(mapped.getData(), mapped.getSize());  // The save after the upgrade restores it
+                fromVersion = probeSchemaVersion(data, size);
+                if (fromVersion >= SCHEMA_VERSION) {
+                    return false;
+                }
+                format = detectSnapshotFormat(data, size);
+
+                wxFile body;
+                if (!body.Create(bodyPath, true)) {
+                    return false;
+                }
+                bool written = true;
+                ChoreSaxLoader loader([&](shared_ptr<Chore> chore) {
+                    // Keys this version does not read come back out of toJSON unchanged
+                    std::string fragment = arraySeparator(format, count) + serializeChoreFragment(chore->toJSON(), format);
+                    written = written && body.Write(fragment.data(), fragment.size()) == fragment.size();
+                    count++;
+                    });
+                bool parsed = parseSnapshotSax(data, size, loader);
+                body.Close();
+                if (!parsed || !written) {
+                    wxLogError("Could not upgrade %s to schema version %d: %s", dynamicFile, SCHEMA_VERSION, wxString(loader.getError()));
+                    wxRemoveFile(bodyPath);
+                    return false;
+                }
+                head = std::move(loader.getRetained());
+            }
+
+            // The original stays next to the data file until the user removes it
+            wxString backupPath = dynamicFile + wxString::Format(".v%d.bak", fromVersion);
+            if (!wxCopyFile(dynamicFile, backupPath, true)) {
+                wxLogError("Could not upgrade %s: the backup %s could not be written.", dynamicFile, backupPath);
+                wxRemoveFile(bodyPath);
+                return false;
+            }
+
+            head[SCHEMA_KEY] = SCHEMA_VERSION;
+            std::string prefix, suffix;
+            encodeAroundChores(head, format, prefix, suffix);
+            prefix += encodeArrayHeader(format, count);
+            suffix = arrayFooter(format, count) + suffix;
+            bool ok = writeFileAtomically(dynamicFile, [&](wxFile& out) {
+                wxFile body;
+                if (!body.Open(bodyPath) || out.Write(prefix.data(), prefix.size()) != prefix.size()) {
+                    return false;
+                }
+                char buffer[64 * 1024];
+                ssize_t n;
+                while ((n = body.Read(buffer, sizeof(buffer))) > 0) {
+                    if (out.Write(buffer, static_cast<size_t>(n)) != static_cast<size_t>(n)) {
+                        return false;
+                    }
+                }
+                return n == 0 && out.Write(suffix.data(), suffix.size()) == suffix.size();
+                });
+            wxRemoveFile(bodyPath);
+            if (!ok) {
+                wxLogError("Could not upgrade %s to schema version %d.", dynamicFile, SCHEMA_VERSION);
+                return false;
+            }
+            wxLogMessage("Upgraded %s from schema version %d to %d (%lu chores); the original is in %s.", dynamicFile, fromVersion, SCHEMA_VERSION, static_cast<unsigned long>(count), backupPath);
+            return true;
+        }
+
+        // Runs on the writer thread once a snapshot is on disk: trim the journal it now contains
+        void onSnapshotWritten(unsigned long long seq, bool ok) {
+            if (ok) {
+                compactJournal(seq);
+                fileRewritten = true;
+            }
+            else {
+                checkpointFailed = true;
+            }
+            checkpointPending = false;
+        }
+
+        // Serialize the current state and hand it to the writer thread
+        void submitSnapshot() {
+            std::map<wxString, std::string> shardFiles;
+            SnapshotPayload payload;
+            if (logStore) {
+                std::string manifest;
+                if (!serializeStoreManifest(manifest)) {
+                    wxLogError("Error writing chores to %s", logStoreDirectory());
+                    return;  // Stays dirty, and the journal keeps the changes
+                }
+                payload = SnapshotPayload(std::move(manifest));
+            }
+            else {
+                payload = shardSize > 0 ? SnapshotPayload(serializeShards(shardFiles)) : serializeState();
+                if (payload.empty()) {
+                    return;  // Stays dirty, and the journal keeps the changes
+                }
+            }
+            if (compressSnapshots) {
+                payload.compress(compressionLevel);  // Compressed by the writer as it streams the file
+                for (auto& shard : shardFiles) {
+                    shard.second = compressSnapshot(shard.second, compressionLevel);
+                }
+            }
+            checkpointPending = true;
+            lastCheckpoint = std::chrono::steady_clock::now();
+            writer.submit(std::move(payload), journalSeq, std::move(shardFiles));
+            dirty = false;
+        }
+
+    public:
+        // Constructor to initialize the ChoreManager object
+        // LOAD_MODE::LAZY indexes the chores and builds each one on first use; a sharded file reads each shard on first use
+        ChoreManager(const wxString& fileName, LOAD_MODE loadMode = LOAD_MODE::EAGER) : dynamicFile(fileName), loadMode(loadMode) {
+            loadData();
+        }
+        // Destructor saves only if something was actually changed
+        ~ChoreManager() {
+            flush();
+            if (dirty) {
+                saveData();
+            }
+            delete client;
+        }
+
+        PersonalChoreList& getPersonalList() {
+            return personalList;
+        }
+
+        // Mark the in-memory data as changed so it is written on the next save
+        void markDirty() {
+            dirty = true;
+            version++;
+        }
+
+        bool isDirty() const {
+            return dirty;
+        }
+
+        // Version number frames can compare to know whether their view is stale
+        unsigned long getVersion() const {
+            return version;
+        }
+
+        // Switch between journaled saves and rewriting the whole file on every change
+        void setJournalMode(bool enabled) {
+            if (journalMode && !enabled) {
+                saveData();  // Fold the journal into the snapshot before leaving journal mode
+            }
+            journalMode = enabled;
+        }
+
+        bool getJournalMode() const {
+            return journalMode;
+        }
+
+        // Checkpoint on the first mutation journaled this long after the last checkpoint, bounding the replay after
+        // a crash; an idle journal is not checkpointed until the next append
+        void setCheckpointInterval(std::chrono::seconds interval) {
+            checkpointInterval = interval;
+        }
+
+        // Merge the journal into the data file on the writer thread
+        void checkpoint() {
+            submitSnapshot();
+        }
+
+        // Queue a save of the current state; bursts of requests become a single write
+        void requestSave() {
+            submitSnapshot();
+        }
+
+        // Wait until every queued snapshot is on disk (called by ChoreApp at shutdown)
+        void flush() {
+            writer.flush();
+            // Our own writes are not external changes; anything else must still show in fileChanged
+            if (fileRewritten.exchange(false)) {
+                refreshFileStamp();
+            }
+            if (checkpointFailed) {
+                checkpointFailed = false;
+                dirty = true;  // Changes are still only in memory or the journal
+                allShardsDirty = shardSize > 0;  // Chores of a failed shard are no longer marked dirty
+            }
+        }
+
+        // Choose the data file format; the file is rewritten in the new format right away
+        void setSnapshotFormat(SNAPSHOT_FORMAT format) {
+            if (format != snapshotFormat) {
+                snapshotFormat = format;
+                allShardsDirty = shardSize > 0;
+                requestSave();
+            }
+        }
+
+        SNAPSHOT_FORMAT getSnapshotFormat() const {
+            return snapshotFormat;
+        }
+
+        // Turn zlib compression of the data file on or off; the file is rewritten right away
+        void setCompression(bool enabled, int level = wxZ_DEFAULT_COMPRESSION) {
+            if (enabled != compressSnapshots || level != compressionLevel) {
+                compressSnapshots = enabled;
+                compressionLevel = level;
+                allShardsDirty = shardSize > 0;
+                requestSave();
+            }
+        }
+
+        bool getCompression() const {
+            return compressSnapshots;
+        }
+
+        // Move the chores into shard files of shardSize consecutive ids; the data file becomes their manifest
+        void enableSharding(size_t size = DEFAULT_SHARD_SIZE) {
+            materializeAll();
+            logStore.reset();  // Chores move from the store into the shards
+            shardSize = std::max<size_t>(size, 1);
+            allShardsDirty = true;
+            requestSave();
+        }
+
+        bool isSharded() const {
+            return shardSize > 0;
+        }
+
+        // Move the chores into a log-structured store next to the data file, which from then on holds only
+        // doers, profile and journal position; saves append changed chores instead of rewriting all of them
+        void enableLogStore() {
+            if (logStore) {
+                return;
+            }
+            materializeAll();
+            shardSize = 0;
+            logStore = std::make_unique<ChoreLogStore>(logStoreDirectory());
+            logStore->clear();
+            for (const auto& chore : chores) {
+                logStore->put(chore->getId(), chore->toJSON().dump());
+                chore->markSaved();
+            }
+            requestSave();
+        }
+
+        bool usesLogStore() const {
+            return logStore != nullptr;
+        }
+
+        // Export the current data as indented JSON text, whatever format the data file uses
+        // Chores are streamed to the file one at a time instead of building one document for all of them
+        bool exportJSON(const wxString& exportFile) {
+            materializeAll();
+            std::ofstream file(exportFile.ToStdString(), std::ios::binary);
+            if (!file) {
+                showError("Error exporting file: " + exportFile, "File Error");
+                return false;
+            }
+            std::string prefix, suffix;
+            encodeSnapshotHead(SNAPSHOT_FORMAT::JSON, prefix, suffix);
+            file << prefix << encodeArrayHeader(SNAPSHOT_FORMAT::JSON, chores.size());
+            for (size_t i = 0; i < chores.size(); i++) {
+                file << arraySeparator(SNAPSHOT_FORMAT::JSON, i) << serializeChoreFragment(chores[i]->toJSON(), SNAPSHOT_FORMAT::JSON);
+            }
+            file << arrayFooter(SNAPSHOT_FORMAT::JSON, chores.size()) << suffix;
+            return static_cast<bool>(file.flush());
+        }
+
+        // Queue depth and write latency of the snapshot writer
+        SnapshotWriter& getWriter() {
+            return writer;
+        }
+
+        // Check whether the data file was changed on disk since it was last loaded or saved
+        bool fileChanged() const {
+            wxFileName fn(dynamicFile);
+            if (!fn.FileExists()) {
+                return fileModTime != 0;
+            }
+            return fn.GetModificationTime().GetTicks() != fileModTime || fn.GetSize() != fileSize;
+        }
+
+        // Merge the data file only if its mtime or size changed; unsaved local edits are kept
+        bool reloadIfChanged() {
+            flush();  // Our own checkpoint is not an external change
+            if (reloadStaleIndex()) {
+                return true;
+            }
+            if (!fileChanged()) {
+                return false;
+            }
+            if (dirty) {
+                wxLogWarning("Data file %s changed on disk, keeping unsaved local changes.", dynamicFile);
+                return false;
+            }
+            mergeFromDisk();
+            return true;
+        }
+
+        // Listen for chores added, changed or removed by an external edit; returns a handle for removeChoreListener
+        int addChoreListener(std::function<void(int choreId, CHORE_EVENT event)> listener) {
+            listeners.emplace_back(++nextListener, std::move(listener));
+            return nextListener;
+        }
+
+        void removeChoreListener(int handle) {
+            listeners.erase(std::remove_if(listeners.begin(), listeners.end(), [handle](const auto& listener) {
+                return listener.first == handle;
+                }), listeners.end());
+        }
+
+        // Merge external edits of the data file as they happen instead of on the next frame open. The directory
+        // is watched because every atomic save replaces the file itself; needs a running event loop
+        void watchDataFile() {
+            if (watcher) {
+                return;
+            }
+            wxFileName file(dynamicFile);
+            file.MakeAbsolute();
+            watchEvents.Bind(wxEVT_FSWATCHER, [this, file](wxFileSystemWatcherEvent& event) {
+                if (event.GetPath().SameAs(file) || event.GetNewPath().SameAs(file)) {
+                    watchTimer.StartOnce(250);  // Restarted by every event of a burst
+                }
+                });
+            watchEvents.Bind(wxEVT_TIMER, [this](wxTimerEvent&) { reloadIfChanged(); });
+            watcher = std::make_unique<wxFileSystemWatcher>();
+            watcher->SetOwner(&watchEvents);
+            watcher->Add(wxFileName::DirName(file.GetPath()), wxFSW_EVENT_CREATE | wxFSW_EVENT_MODIFY | wxFSW_EVENT_RENAME | wxFSW_EVENT_DELETE);
+        }
+
+        // Method to load data from the JSON file
+        void loadData() {
+            flush();
+            bool upgraded = upgradeSchema();
+            // Parse straight from a read-only mapping of the file when possible
+            MappedFile mapped(dynamicFile);
+            std::string contents;
+            const char* data = mapped.getData();
+            size_t size = mapped.getSize();
+            if (!mapped.isOpen()) {
+                std::ifstream file(dynamicFile.ToStdString(), std::ios::binary);
+                if (!file) {
+                    showError("Error opening file: " + dynamicFile, "File Error");
+                    j = json::object(); // Initialize an empty JSON object if file fails to open
+                    return;
+                }
+                contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+                file.close();
+                data = contents.data();
+                size = contents.size();
+            }
+
+            // A compressed file is inflated first and keeps being written compressed
+            std::string inflated;
+            bool compressed = isCompressedSnapshot(data, size);
+            if (compressed) {
+                if (!decompressSnapshot(data, size, inflated)) {
+                    showError("Error decompressing file: " + dynamicFile, "File Error");
+                    j = json::object();
+                    return;
+                }
+                data = inflated.data();
+                size = inflated.size();
+            }
+            // Follow what the file actually is, not an earlier load; an upgraded file was written uncompressed
+            // and its original compression, noted by upgradeSchema, is restored by the save below
+            compressSnapshots = compressed || (upgraded && compressSnapshots);
+
+            // Text JSON, CBOR or MessagePack, recognized by the first bytes; text files are
+            // rewritten in the configured text style (compact by default)
+            SNAPSHOT_FORMAT detected = detectSnapshotFormat(data, size);
+            if (!isTextFormat(detected) || !isTextFormat(snapshotFormat)) {
+                snapshotFormat = detected;
+            }
+            // The previous load's arena goes away with the last of its chores still referenced elsewhere
+            chores.clear();
+            arena = std::make_shared<ChoreArena>();
+            lazy = false;
+            lazyIndex.clear();
+            lazyById.clear();
+            bool indexed = loadMode == LOAD_MODE::LAZY && !compressed && isTextFormat(snapshotFormat) && loadIndex(data, size);
+            if (!indexed) {
+                // Chores are built while parsing; only the small top-level sections are kept in j
+                ChoreSaxLoader loader([this](shared_ptr<Chore> chore) { chores.push_back(adoptChore(chore)); }, arena);
+                if (parseSnapshotSax(data, size, loader)) {
+                    j = std::move(loader.getRetained());
+                }
+                else {
+                    showError("JSON Parsing Error: " + wxString(loader.getError()), "JSON Error");
+                    j = json::object(); // Initialize an empty JSON object if parsing fails
+                    chores.clear();
+                }
+            }
+            // A manifest lists shard files instead of holding the chores itself
+            shardSize = 0;
+            allShardsDirty = false;
+            dirtyShards.clear();
+            unloadedShards.clear();
+            if (j.contains("shards")) {
+                lazy = false;
+                lazyIndex.clear();
+                lazyById.clear();
+                loadShards();
+            }
+            // A manifest of a log-structured store
+            logStore.reset();
+            unreadStoreIds.clear();
+            if (j.value("store", "") == "log") {
+                j.erase("store");
+                lazy = false;
+                lazyIndex.clear();
+                lazyById.clear();
+                loadLogStore();
+            }
+            // Load client from JSON
+            delete client;
+            if (j.contains("user_profile") && !j["user_profile"].is_null()) {
+                auto userProfile = j["user_profile"];
+                wxString username = userProfile.value("username", "defaultUser");
+                wxString theme = userProfile.value("theme", "light");
+                bool notify = userProfile.value("notify", false);
+                client = new Client(username, theme, notify);
+            }
+            else {
+                client = new Client("defaultUser", "light", false);
+            }
+            dirty = false;
+            loadChoreDoers();
+            checkpointSeq = j.value("journal_seq", 0ULL);
+            replayJournal();
+            refreshFileStamp();
+            version++;
+            if (upgraded && compressSnapshots) {
+                requestSave();  // The upgrade writes plain text or binary, compress it again
+            }
+        }
+
+        // Method to load chore doers and their assignments saved in the snapshot
+        void loadChoreDoers() {
+            doers.clear();
+            if (!j.contains("chore_doers") || !j["chore_doers"].is_array()) {
+                return;
+            }
+            suppressJournal = true;
+            for (const auto& doerJson : j["chore_doers"]) {
+                wxString doerName = doerJson.value("name", "");
+                addChoreDoer(doerName, doerJson.value("age", 0));
+                if (doerJson.contains("assigned") && doerJson["assigned"].is_array()) {
+                    for (const auto& choreId : doerJson["assigned"]) {
+                        assignChoreDoer(choreId.get<int>(), doerName);
+                    }
+                }
+            }
+            suppressJournal = false;
+        }
+
+        // Method to load chore doers from the JSON file
+        void addChoreDoer(const wxString& name, int age) {
+            auto doer = std::make_shared<ChoreDoer>(name, age);
+            doers.push_back(doer);
+            if (!suppressJournal) {
+                markDirty();
+                appendJournal({ {"op", "doer"}, {"name", name}, {"age", age} });
+            }
+        }
+
+        // Method to assign a chore to a ChoreDoer
+        void assignChoreDoer(int choreId, const wxString& doerName) {
+            auto chore = findChoreById(choreId);
+            if (chore) {
+                auto doer = find_if(doers.begin(), doers.end(), [doerName](const shared_ptr<ChoreDoer>& d) {
+                    return d->getName() == doerName;
+                    });
+
+                if (doer != doers.end()) {
+                    (*doer)->assignChore(chore);
+                    if (!suppressJournal) {
+                        markDirty();
+                        appendJournal({ {"op", "assign"}, {"id", choreId}, {"doer", doerName} });
+                    }
+                }
+                else {
+                    wxLogError("ChoreDoer %s not found.", doerName);
+                }
+            }
+            else {
+                wxLogError("Chore ID %d not found.", choreId);
+            }
+        }
+
+        // Method to display the ChoreDoer details
+        wxString displayAssignedChores(const wxString& doerName) {
+            auto doer = std::find_if(doers.begin(), doers.end(), [&doerName](const std::shared_ptr<ChoreDoer>& d) {
+                return d->name == doerName;
+                });
+
+            if (doer != doers.end()) {
+                return (*doer)->printChoreDoer();
+            }
+
+            return "Chore Doer not found.";
+        }
+
+
+        // Method to add a new chore to the list
+        void addChore(const json& choreJson) {
+            if (!choreJson.is_null()) {
+                auto chore = makeChore(choreJson);
+                if (lazy) {
+                    // Stays in the index until everything is materialized
+                    lazyById[chore->getId()] = lazyIndex.size();
+                    lazyIndex.push_back({ chore->getId(), chore->getName(), 0, 0, chore });
+                }
+                else {
+                    readPending(chore->getId());  // Its shard is rewritten with it, so its other chores must be known
+                    chores.push_back(chore);
+                }
+                markDirty();
+                if (journalMode) {
+                    appendJournal({ {"op", "add"}, {"chore", chore->toJSON()} });
+                }
+                else {
+                    requestSave();  // Save every time a chore is added
+                }
+            }
+            else {
+                showError("Error adding chore: Invalid JSON", "JSON Error");
+            }
+        }
+        // Add every chore of a CSV or JSON Lines feed, skipping invalid records and ids that already exist;
+        // everything is committed with one snapshot write instead of one journal record per chore
+        ImportReport importChores(const wxString& path) {
+            ImportReport report;
+            auto start = std::chrono::steady_clock::now();
+            MappedFile mapped(path);
+            std::string contents;
+            const char* data = mapped.getData();
+            size_t size = mapped.getSize();
+            if (!mapped.isOpen()) {
+                std::ifstream file(path.ToStdString(), std::ios::binary);
+                if (!file) {
+                    wxLogError("Error opening import file: %s", path);
+                    return report;
+                }
+                contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+                data = contents.data();
+                size = contents.size();
+            }
+
+            ChoreImporter importer(feedFormatForFile(path));
+            vector<shared_ptr<Chore>> parsed = importer.parse(data, size, report);
+
+            materializeAll();
+            std::unordered_set<int> ids;
+            for (const auto& chore : chores) {
+                ids.insert(chore->getId());
+            }
+            chores.reserve(chores.size() + parsed.size());
+            for (auto& chore : parsed) {
+                if (!ids.insert(chore->getId()).second) {
+                    report.duplicates++;
+                    continue;
+                }
+                chores.push_back(adoptChore(chore));
+                report.imported++;
+            }
+
+            if (report.imported > 0) {
+                markDirty();
+                saveData();
+            }
+            report.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            return report;
+        }
+
+        // Stream chores to a CSV or JSON Lines file one row at a time and return the number of rows written.
+        // In lazy mode each chore is decoded from the data file only while its row is written, so memory
+        // stays bounded; sorting keeps just the sort key and position of every selected chore.
+        size_t exportChores(const wxString& path, const ExportOptions& options) {
+            flush();  // Index offsets must describe the file on disk
+            readAllPending();
+            if (lazy && !indexMatchesFile()) {
+                reloadStaleIndex();
+            }
+            std::unique_ptr<MappedFile> mapped;
+            if (lazy) {
+                mapped = std::make_unique<MappedFile>(dynamicFile);
+                if (!mapped->isOpen()) {
+                    materializeAll();
+                }
+            }
+            // Chore at a position of the store, decoded just for the caller in lazy mode
+            auto choreAt = [this, &mapped](size_t position) -> shared_ptr<Chore> {
+                if (!lazy) {
+                    return chores[position];
+                }
+                const ChoreIndexEntry& entry = lazyIndex[position];
+                return entry.chore ? entry.chore : decodeChore(mapped->getData() + entry.offset, entry.length);
+            };
+            size_t count = lazy ? lazyIndex.size() : chores.size();
+
+            ChoreFeedWriter writer(path, options.format, options.fields);
+            if (!writer.isOpen()) {
+                wxLogError("Error opening export file: %s", path);
+                return 0;
+            }
+            size_t rows = 0;
+            size_t skipped = 0;   // Records of the data file that cannot be read
+            if (options.sortBy.empty()) {
+                for (size_t i = 0; i < count; i++) {
+                    shared_ptr<Chore> chore = choreAt(i);
+                    skipped += !chore;
+                    if (chore && (!options.filter || options.filter(*chore))) {
+                        writer.write(*chore);
+                        rows++;
+                    }
+                }
+            }
+            else {
+                vector<std::pair<json, size_t>> keys;
+                for (size_t i = 0; i < count; i++) {
+                    shared_ptr<Chore> chore = choreAt(i);
+                    skipped += !chore;
+                    if (chore && (!options.filter || options.filter(*chore))) {
+                        keys.emplace_back(chore->toJSON().value(options.sortBy, json()), i);
+                    }
+                }
+                std::stable_sort(keys.begin(), keys.end(), [&options](const auto& a, const auto& b) {
+                    return options.ascending ? a.first < b.first : b.first < a.first;
+                    });
+                for (const auto& key : keys) {
+                    if (shared_ptr<Chore> chore = choreAt(key.second)) {
+                        writer.write(*chore);
+                        rows++;
+                    }
+                }
+            }
+            if (!writer.close()) {
+                wxLogError("Error writing export file: %s", path);
+            }
+            if (skipped > 0) {
+                wxLogWarning("Skipped %zu unreadable chores while exporting to %s", skipped, path);
+            }
+            return rows;
+        }
+
+        // Stream a summary to a CSV or JSON Lines file: one row per day, status or difficulty with its number of
+        // chores, how many of them are completed and their earnings. The totals come from the ChoreArray, which
+        // decodes a copy of every chore once and is reused until something changes. Returns the number of rows written
+        size_t exportReport(const wxString& path, REPORT report, FEED_FORMAT format) {
+            vector<std::string> groups;
+            if (report == REPORT::BY_DAY) {
+                for (size_t day = 0; day < WEEKDAY_COUNT; day++) {
+                    groups.push_back(weekdayName(static_cast<WEEKDAY>(day)));
+                }
+            }
+            else if (report == REPORT::BY_STATUS) {
+                groups = { "not_started", "in_progress", "completed" };
+            }
+            else {
+                groups = { "easy", "medium", "hard" };
+            }
+            struct Totals {
+                size_t chores = 0;
+                size_t completed = 0;
+                long long earnings = 0;
+            };
+            vector<Totals> totals(groups.size());
+            auto add = [&totals](size_t group, const Chore& chore) {
+                totals[group].chores++;
+                totals[group].completed += chore.getStatus() == STATUS::COMPLETED;
+                totals[group].earnings += chore.getEarnings();
+            };
+            getChoreArray().forEach([&](const auto& chore) {
+                if (report == REPORT::BY_DAY) {
+                    DayMask days = chore.getDayMask();
+                    for (size_t day = 0; day < WEEKDAY_COUNT; day++) {
+                        if ((days >> day) & 1) {
+                            add(day, chore);
+                        }
+                    }
+                }
+                else {
+                    add(report == REPORT::BY_STATUS ? static_cast<size_t>(chore.getStatus()) : static_cast<size_t>(chore.getDifficulty()), chore);
+                }
+                });
+
+            ChoreFeedWriter writer(path, format, { "group", "chores", "completed", "earnings" });
+            if (!writer.isOpen()) {
+                wxLogError("Error opening report file: %s", path);
+                return 0;
             }
-            else {
-                client = new Client("defaultUser", "light", false);
+            for (size_t i = 0; i < groups.size(); i++) {
+                writer.writeRow({ {"group", groups[i]}, {"chores", totals[i].chores}, {"completed", totals[i].completed}, {"earnings", totals[i].earnings} });
             }
-            // call loadChores method
-            loadChores();
+            if (!writer.close()) {
+                wxLogError("Error writing report file: %s", path);
+            }
+            return groups.size();
         }
 
-        // Method to load chores from the JSON file
-        void loadChores() {
-            if (j.contains("chores") && j["chores"].is_array()) {
-                chores.clear(); // Clear existing chores before loading new ones
-                for (const auto& choreJson : j["chores"]) {
-                    auto chore = std::make_shared<Chore>(choreJson);
-                    chores.push_back(chore);
+        // Build a delta of every chore changed since the last sync and hand it to deliver. Unchanged chores are
+        // recognized by comparing their compact JSON with the baseline, so only changed chores are diffed; the
+        // baseline moves forward only once deliver succeeds. Returns false if nothing changed or delivery failed
+        bool sendDelta(const std::function<bool(const json& delta)>& deliver) {
+            flush();  // Index offsets must describe the file on disk
+            readAllPending();
+            if (lazy && !indexMatchesFile()) {
+                reloadStaleIndex();
+            }
+            size_t lines = 0;
+            std::unordered_map<int, std::string> base = loadSyncBase(lines);
+            std::unique_ptr<MappedFile> mapped;
+            if (lazy) {
+                mapped = std::make_unique<MappedFile>(dynamicFile);
+                if (!mapped->isOpen()) {
+                    materializeAll();
                 }
             }
-        }
-
-        // Method to load chore doers from the JSON file
-        void addChoreDoer(const wxString& name, int age) {
-            auto doer = std::make_shared<ChoreDoer>(name, age);
-            doers.push_back(doer);
-        }
-
-        // Method to assign a chore to a ChoreDoer
-        void assignChoreDoer(int choreId, const wxString& doerName) {
-            auto chore = find_if(chores.begin(), chores.end(), [choreId](const shared_ptr<Chore>& c) {
-                return c->getId() == choreId;
-                });
-            if (chore != chores.end()) {
-                auto doer = find_if(doers.begin(), doers.end(), [doerName](const shared_ptr<ChoreDoer>& d) {
-                    return d->getName() == doerName;
-                    });
-
-                if (doer != doers.end()) {
-                    (*doer)->assignChore(*chore);
+            size_t count = lazy ? lazyIndex.size() : chores.size();
+
+            json changed = json::array();
+            json removed = json::array();
+            vector<std::pair<int, std::string>> records;
+            std::unordered_set<int> seen;
+            std::string current;
+            for (size_t i = 0; i < count; i++) {
+                int choreId;
+                current.clear();
+                if (lazy && !lazyIndex[i].chore) {
+                    const ChoreIndexEntry& entry = lazyIndex[i];
+                    choreId = entry.id;
+                    appendMinifiedJSON(current, mapped->getData() + entry.offset, entry.length);
                 }
                 else {
-                    wxLogError("ChoreDoer %s not found.", doerName);
+                    Chore& chore = lazy ? *lazyIndex[i].chore : *chores[i];
+                    choreId = chore.getId();
+                    // Compact snapshots cache the same text the next save writes, so it is encoded only once
+                    current = snapshotFormat == SNAPSHOT_FORMAT::JSON_COMPACT ? chore.getSerialized(snapshotFormat) : chore.toJSON().dump();
+                }
+                seen.insert(choreId);
+                auto before = base.find(choreId);
+                if (before != base.end() && before->second == current) {
+                    continue;
+                }
+                json after = json::parse(current, nullptr, false);
+                if (after.is_discarded()) {
+                    continue;
+                }
+                json old = before != base.end() ? json::parse(before->second, nullptr, false) : json();
+                if (old == after) {
+                    continue;  // Same chore written differently, e.g. raw bytes of a lazily loaded file
+                }
+                std::string full = after.dump();
+                json patch = old.is_object() ? json::diff(old, after) : json();
+                if (!patch.is_null() && patch.dump().size() < full.size()) {
+                    changed.push_back({ {"id", choreId}, {"patch", std::move(patch)} });
+                }
+                else {
+                    changed.push_back({ {"id", choreId}, {"chore", std::move(after)} });
                 }
+                records.emplace_back(choreId, std::move(full));
             }
-            else {
-                wxLogError("Chore ID %d not found.", choreId);
+            for (const auto& synced : base) {
+                if (!seen.count(synced.first)) {
+                    removed.push_back(synced.first);
+                    records.emplace_back(synced.first, std::string());
+                }
             }
-        }
-
-        // Method to display the ChoreDoer details
-        wxString displayAssignedChores(const wxString& doerName) {
-            auto doer = std::find_if(doers.begin(), doers.end(), [&doerName](const std::shared_ptr<ChoreDoer>& d) {
-                return d->name == doerName;
-                });
-
-            if (doer != doers.end()) {
-                return (*doer)->printChoreDoer();
+            if (changed.empty() && removed.empty()) {
+                return false;
+            }
+            if (!deliver({ {"chores", std::move(changed)}, {"removed", std::move(removed)} })) {
+                return false;
             }
 
-            return "Chore Doer not found.";
+            // Rewrite the baseline once superseded lines outnumber the live ones, otherwise just append
+            if (lines + records.size() > 2 * (base.size() + records.size()) + 1024) {
+                for (const auto& record : records) {
+                    if (record.second.empty()) {
+                        base.erase(record.first);
+                    }
+                    else {
+                        base[record.first] = record.second;
+                    }
+                }
+                std::string contents;
+                for (const auto& synced : base) {
+                    contents += makeChoreRecord(synced.first, synced.second);
+                }
+                if (!writeFileAtomically(syncBaseFile(), contents)) {
+                    wxLogError("Error writing sync baseline: %s", syncBaseFile());
+                }
+                return true;
+            }
+            appendSyncBase(records);
+            return true;
         }
 
-
-        // Method to add a new chore to the list
-        void addChore(const json& choreJson) {
-            if (!choreJson.is_null()) {
-                auto chore = std::make_shared<Chore>(choreJson);
-                chores.push_back(chore);
-                saveData();  // Save every time a chore is added
-            }
-            else {
-                wxMessageBox("Error adding chore: Invalid JSON", "JSON Error", wxOK | wxICON_ERROR);
+        // Apply a delta from another copy of the data file. Patches apply to the chore as it is here, so fields
+        // changed on both sides keep the incoming value and other local edits survive. Only the chores named
+        // in the delta are touched, and they are recorded as synced so they are not sent straight back
+        SyncReport applyDelta(const json& delta) {
+            SyncReport report;
+            vector<std::pair<int, std::string>> records;
+            auto chores = delta.find("chores");
+            if (chores != delta.end() && chores->is_array()) {
+                for (const auto& entry : *chores) {
+                    int choreId = entry.value("id", -1);
+                    json choreJson;
+                    if (entry.contains("chore")) {
+                        choreJson = entry["chore"];
+                    }
+                    else {
+                        shared_ptr<Chore> existing = findChoreById(choreId);
+                        if (!existing || !entry.contains("patch")) {
+                            report.conflicts++;
+                            continue;
+                        }
+                        try {
+                            choreJson = existing->toJSON().patch(entry["patch"]);
+                        }
+                        catch (const json::exception&) {
+                            report.conflicts++;
+                            continue;
+                        }
+                    }
+                    shared_ptr<Chore> chore;
+                    try {
+                        chore = makeChore(choreJson);
+                    }
+                    catch (const json::exception&) {
+                        report.conflicts++;
+                        continue;
+                    }
+                    putChore(chore);
+                    json applied = chore->toJSON();
+                    records.emplace_back(chore->getId(), applied.dump());
+                    appendJournal({ {"op", "modify"}, {"id", chore->getId()}, {"chore", std::move(applied)} });
+                    report.applied++;
+                }
             }
-        }
-        // saveData method to save the data to the JSON file
-        void saveData() {
-            json j;
-            if (client) {
-                j["user_profile"] = {
-                    {"username", client->getUsername().ToStdString()},
-                    {"theme", client->getTheme().ToStdString()},
-                    {"notify", client->getNotify()}
-                };
+            auto removed = delta.find("removed");
+            if (removed != delta.end() && removed->is_array()) {
+                for (const auto& id : *removed) {
+                    if (id.is_number_integer() && eraseChore(id.get<int>())) {
+                        records.emplace_back(id.get<int>(), std::string());
+                        appendJournal({ {"op", "remove"}, {"id", id.get<int>()} });
+                        report.removed++;
+                    }
+                }
             }
-
-            json choresJson = json::array();
-            for (const auto& chore : chores) {
-                choresJson.push_back(chore->toJSON());
+            if (!records.empty()) {
+                markDirty();
+                if (!journalMode) {
+                    requestSave();
+                }
+                appendSyncBase(records);
             }
-            j["chores"] = choresJson;
+            return report;
+        }
 
-            std::ofstream file(dynamicFile.ToStdString());
-            if (file) {
-                file << std::setw(4) << j << std::endl;
-            }
-            else {
-                wxMessageBox("Error saving file: " + dynamicFile, "File Error", wxOK | wxICON_ERROR);
+        // saveData method to save the data to the JSON file (and fold in the journal) and wait for it
+        void saveData() {
+            submitSnapshot();
+            flush();
+            if (dirty) {
+                showError("Error saving file: " + dynamicFile, "File Error");
             }
-            file.close();
         }
 
         // Method to display the client profile
-        bool userExists(const wxString& username) {
-            return j["user_profiles"].find(username.ToStdString()) != j["user_profiles"].end();
+        // Profile of the user owning this data file
+        Client* getClient() const {
+            return client;
         }
 
-        // Method to create a new user profile
-        void createUser(const wxString& username, const wxString& theme, bool notify) {
-            json newUser = {
-                {"username", username.ToStdString()},
-                {"theme", theme.ToStdString()},
-                {"notify", notify}
-            };
-            j["user_profiles"][username.ToStdString()] = newUser;
-            saveData();
+        // Make username the owner of this data file (the "user_profile" section)
+        void setUserProfile(const wxString& username, const wxString& theme, bool notify) {
+            if (client && client->getUsername() == username && client->getTheme() == theme && client->getNotify() == notify) {
+                return;
+            }
+            delete client;
+            client = new Client(username, theme, notify);
+            markDirty();
+            if (journalMode) {
+                appendJournal({ {"op", "profile"}, {"profile", { {"username", username.ToStdString()}, {"theme", theme.ToStdString()}, {"notify", notify} }} });
+            }
+            else {
+                requestSave();
+            }
         }
 
-        // Method to update the user profile
-        void updateUser(const wxString& username, const wxString& theme, bool notify) {
-            j["user_profiles"][username.ToStdString()] = {
-                {"username", username.ToStdString()},
-                {"theme", theme.ToStdString()},
-                {"notify", notify}
-            };
-            saveData();
-        }
         //GetChoreByName added to work with ChoresFrame to find chore information
         //function returns a shared pointer to a Chore object
         //paramaters are a wxString that will come from inside the frame Choice section
@@ -1230,17 +6211,77 @@ namespace ChoreAppNamespace {
         this function can be copied and used for a "search by x" where x is what you want to search for
         ************************************************************/
         shared_ptr<Chore> getChoreByName(const wxString& name) {
+            shared_ptr<Chore> chore = findChoreByName(name);
+            if (!chore) {
+                showError("Chore with Name " + name + "not found!", "Chore Not Found");
+            }
+            return chore;
+        }
+
+        // Look up a chore by id; in lazy mode only that chore is built
+        shared_ptr<Chore> getChoreById(int choreId) {
+            shared_ptr<Chore> chore = findChoreById(choreId);
+            if (!chore && reloadStaleIndex()) {
+                chore = findChoreById(choreId);  // The index no longer matched the file: look again in the reloaded one
+            }
+            return chore;
+        }
+
+        // Same lookup without the message box; in lazy mode only the matching chore is built
+        shared_ptr<Chore> findChoreByName(const wxString& name) {
+            if (lazy) {
+                auto entry = find_if(lazyIndex.begin(), lazyIndex.end(), [&name](const ChoreIndexEntry& e) {
+                    return e.name == name;
+                    });
+                shared_ptr<Chore> chore = entry != lazyIndex.end() ? materialize(*entry) : nullptr;
+                if (!chore && reloadStaleIndex()) {
+                    return findChoreByName(name);
+                }
+                return chore;
+            }
+            readAllPending();
             //it is finding if the chore exists. 3rd param is a lamba that is defininng the criteria for finding the chore
             auto it = find_if(chores.begin(), chores.end(), [&name](const shared_ptr<Chore>& chore) {
                 return chore->getName() == name;
                 });
-            if (it != chores.end()) {
-                return *it;
+            return it != chores.end() ? *it : nullptr;
+        }
+
+        // Id and name of every chore, in file order, without building lazily loaded chores
+        vector<std::pair<int, wxString>> getChoreTitles() {
+            vector<std::pair<int, wxString>> titles;
+            readAllPending();  // Shard manifests hold no names
+            if (lazy) {
+                for (const auto& entry : lazyIndex) {
+                    titles.emplace_back(entry.id, entry.name);
+                }
             }
             else {
-                wxMessageBox("Chore with Name " + name + "not found!", "Chore Not Found", wxOK | wxICON_ERROR);
-                return nullptr;
+                for (const auto& chore : chores) {
+                    titles.emplace_back(chore->getId(), chore->getName());
+                }
+            }
+            return titles;
+        }
+
+        vector<wxString> getChoreNames() {
+            vector<wxString> names;
+            readAllPending();
+            if (lazy) {
+                for (const auto& entry : lazyIndex) {
+                    names.push_back(entry.name);
+                }
+            }
+            else {
+                for (const auto& chore : chores) {
+                    names.push_back(chore->getName());
+                }
             }
+            return names;
+        }
+
+        bool isLazy() const {
+            return lazy;
         }
         // don't think we need this
         bool validateUser(wxString w, wxString z) {
@@ -1248,6 +6289,7 @@ namespace ChoreAppNamespace {
         }
         template<typename Comparator>
         void sortChores(Comparator comp, bool ascending = true) {
+            materializeAll();
             try
             {
                 // Use std::sort to sort the chores vector
@@ -1265,9 +6307,52 @@ namespace ChoreAppNamespace {
         }
         // Method to display the chore list
         //******************************************************************
+        // Columnar view of the chores for scans, filters, sorts and totals; rebuilt only after something changed
+        const ChoreTable& getChoreTable() {
+            if (tableVersion == version) {
+                return table;
+            }
+            table.clear();
+            table.reserve(lazy ? lazyIndex.size() : chores.size());
+            visitAllChores([this](const Chore& chore) { table.append(chore); });
+            tableVersion = version;
+            return table;
+        }
+
+        // Copies of the chores stored by value, one variant per chore, for loops that want neither pointer chasing
+        // nor virtual calls; rebuilt only after something changed. Edit chores through getChoreById, not the copies
+        const ChoreArray& getChoreArray() {
+            if (arrayVersion == version) {
+                return choreArray;
+            }
+            choreArray.clear();
+            choreArray.reserve(lazy ? lazyIndex.size() : chores.size());
+            visitAllChores([this](const Chore& chore) { choreArray.push_back(chore); });
+            arrayVersion = version;
+            return choreArray;
+        }
+
+        // Chores due on day
+        vector<shared_ptr<Chore>> getChoresDueOn(WEEKDAY day) {
+            return getChoresDueOnAny(dayBit(day));
+        }
+
+        // Chores due on at least one of the days in mask
+        vector<shared_ptr<Chore>> getChoresDueOnAny(DayMask mask) {
+            materializeAll();
+            vector<shared_ptr<Chore>> due;
+            for (const auto& chore : chores) {
+                if (chore->isDueOnAny(mask)) {
+                    due.push_back(chore);
+                }
+            }
+            return due;
+        }
+
         //CHANGED DISPLAY CHORES TO WORK WITH WXWIDGETS (void function not allowed)
         vector<shared_ptr<Chore>> displayChores()
         {
+            materializeAll();
             vector<shared_ptr<Chore>> choreList;
             for (const auto& chore : chores)
             {
@@ -1284,20 +6369,157 @@ namespace ChoreAppNamespace {
         //}
 
     };
+    //*********************************************************************************************************************
+    // File-drop transport for delta sync between two copies of the data file: each side writes its deltas
+    // into a shared directory as "<time>-<peer>.delta" and applies and deletes the ones the other side left
+    class FileDropSync {
+    private:
+        wxString directory;
+        wxString peer;
+
+    public:
+        FileDropSync(const wxString& directory, const wxString& peer) : directory(directory), peer(peer) {}
+
+        // Drop a delta of everything changed since the last sync; false if nothing changed or the drop failed
+        bool send(ChoreManager& manager) {
+            if (!wxDirExists(directory) && !wxFileName::Mkdir(directory, wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL)) {
+                wxLogError("Error creating sync directory: %s", directory);
+                return false;
+            }
+            return manager.sendDelta([this](const json& delta) {
+                long long stamp = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+                wxString path;
+                do {
+                    path = directory + wxFileName::GetPathSeparator() + wxString::Format("%013lld-%s.delta", stamp++, peer);
+                } while (wxFileExists(path));
+                return writeFileAtomically(path, delta.dump());
+                });
+        }
+
+        // Apply, oldest first, the deltas other peers dropped, removing each once applied
+        SyncReport receive(ChoreManager& manager) {
+            SyncReport report;
+            wxArrayString files;
+            if (!wxDirExists(directory) || wxDir::GetAllFiles(directory, &files, "*.delta", wxDIR_FILES) == 0) {
+                return report;
+            }
+            files.Sort();
+            for (const auto& file : files) {
+                if (file.EndsWith("-" + peer + ".delta")) {
+                    continue;  // Our own, waiting for the other side
+                }
+                std::ifstream in(file.ToStdString(), std::ios::binary);
+                json delta = json::parse(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>(), nullptr, false);
+                in.close();
+                if (delta.is_discarded()) {
+                    wxLogWarning("Ignoring unreadable delta: %s", file);
+                    continue;
+                }
+                report += manager.applyDelta(delta);
+                wxRemoveFile(file);
+            }
+            return report;
+        }
+    };
+
+    //*********************************************************************************************************************
+    // Recovery benchmark: synthetic data files are built from the chores of a template data file, each with a journal
+    // left behind as if the app crashed before its next checkpoint, and the time ChoreManager takes to come back
+    // (load plus journal replay) is measured for every dataset size and journal length, eager and lazy; false if the
+    // template has no chores
+    inline bool runRecoveryBenchmark(const wxString& templateFile, const wxString& directory, std::ostream& out) {
+        std::ifstream in(templateFile.ToStdString(), std::ios::binary);
+        json templateJson = json::parse(in, nullptr, false);
+        if (templateJson.is_discarded() || !templateJson.contains("chores") || templateJson["chores"].empty()) {
+            out << "Cannot read chores from " << templateFile << std::endl;
+            return false;
+        }
+        vector<json> samples;
+        for (const auto& chore : templateJson["chores"]) {
+            samples.push_back(Chore::fromJSON(chore)->toJSON());  // In the current schema whatever the template's version
+        }
+        if (!wxDirExists(directory)) {
+            wxFileName::Mkdir(directory, wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL);
+        }
+        wxString dataFile = directory + wxFileName::GetPathSeparator() + "recovery.json";
+        static const size_t datasetSizes[] = { 1000, 10000, 100000 };
+        static const size_t journalLengths[] = { 0, 1000, 10000, 100000 };
+        static const char* statuses[] = { "not_started", "in_progress", "completed" };
+
+        out << std::setw(8) << "chores" << std::setw(9) << "journal" << std::setw(10) << "data KB" << std::setw(12) << "journal KB"
+            << std::setw(10) << "eager ms" << std::setw(9) << "lazy ms" << std::endl;
+        for (size_t choreCount : datasetSizes) {
+            std::string snapshot = "{\"" + SCHEMA_KEY + "\":" + std::to_string(SCHEMA_VERSION) + ",\"chores\":[";
+            for (size_t i = 0; i < choreCount; i++) {
+                json chore = samples[i % samples.size()];
+                chore["id"] = i + 1;
+                chore["name"] = chore["name"].get<std::string>() + " " + std::to_string(i + 1);
+                snapshot += (i ? "," : "") + chore.dump();
+            }
+            snapshot += "]}";
+
+            for (size_t journalLength : journalLengths) {
+                // Mostly status changes, then edits, then new chores, spread over random ids
+                std::mt19937 random(static_cast<unsigned>(choreCount + journalLength));
+                std::string journal;
+                for (size_t r = 0; r < journalLength; r++) {
+                    int choreId = static_cast<int>(random() % choreCount) + 1;
+                    unsigned kind = random() % 10;
+                    json record;
+                    if (kind < 6) {
+                        record = { {"op", "status"}, {"id", choreId}, {"status", statuses[random() % 3]} };
+                    }
+                    else {
+                        json chore = samples[choreId % samples.size()];
+                        chore["id"] = kind < 9 ? choreId : static_cast<int>(choreCount + r + 1);
+                        chore["earnings"] = static_cast<int>(random() % 50);
+                        record = { {"op", kind < 9 ? "modify" : "add"}, {"chore", chore} };
+                        if (kind < 9) {
+                            record["id"] = choreId;
+                        }
+                    }
+                    record["seq"] = r + 1;
+                    journal += record.dump() + "\n";
+                }
+
+                double ms[2];
+                for (int mode = 0; mode < 2; mode++) {
+                    // Fresh files every run: the previous manager checkpointed the journal away on exit
+                    writeFileAtomically(dataFile, snapshot);
+                    writeFileAtomically(dataFile + ".journal", journal);
+                    wxRemoveFile(dataFile + ".idx");
+                    auto start = std::chrono::steady_clock::now();
+                    {
+                        ChoreManager manager(dataFile, mode == 0 ? LOAD_MODE::EAGER : LOAD_MODE::LAZY);
+                        ms[mode] = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+                    }
+                }
+                out << std::setw(8) << choreCount << std::setw(9) << journalLength << std::setw(10) << snapshot.size() / 1024
+                    << std::setw(12) << journal.size() / 1024 << std::fixed << std::setprecision(1)
+                    << std::setw(10) << ms[0] << std::setw(9) << ms[1] << std::endl;
+            }
+        }
+        wxRemoveFile(dataFile);
+        wxRemoveFile(dataFile + ".journal");
+        wxRemoveFile(dataFile + ".idx");
+        return true;
+    }
+
     //******************************************************
     // SEARCH CHORES FRAME
     class SearchFrame :public wxFrame {
     public:
-        SearchFrame(const wxString& title, const wxPoint& pos, const wxSize& size);
+        SearchFrame(const wxString& title, const wxPoint& pos, const wxSize& size, ChoreManager* choreManager);
     private:
         void OnSearch(wxCommandEvent& event);
+        ChoreManager* m_choreManager; // Shared ChoreManager owned by ChoreApp
         //searchin box variable
         wxTextCtrl* searchTextCtrl;
         //search button variable
         wxButton* searchButton;
     };
-    SearchFrame::SearchFrame(const wxString& title, const wxPoint& pos, const wxSize& size)
-        :wxFrame(nullptr, wxID_ANY, title, pos, size) {
+    SearchFrame::SearchFrame(const wxString& title, const wxPoint& pos, const wxSize& size, ChoreManager* choreManager)
+        :wxFrame(nullptr, wxID_ANY, title, pos, size), m_choreManager(choreManager) {
         //control panel
         wxPanel* panel = new wxPanel(this, wxID_ANY);
         //sizer for layour purposes
@@ -1315,20 +6537,16 @@ namespace ChoreAppNamespace {
 
     }
     void SearchFrame::OnSearch(wxCommandEvent& event) {
-        ChoreManager choreManager(DATA_FILE_PATH + "data.json");
+        // Pick up external edits to the data file, otherwise reuse what is already loaded
+        m_choreManager->reloadIfChanged();
 
         wxString searchText = searchTextCtrl->GetValue();
         try {
-            bool foundChore = false;
-            for (const auto& chore : choreManager.displayChores()) {
-                if (searchText == chore->getName()) {
-                    wxMessageBox("FOUND CHORE", "Found chore", wxOK | wxICON_INFORMATION);
-                    foundChore = true;
-                    break;
-                }
-
+            bool foundChore = m_choreManager->findChoreByName(searchText) != nullptr;
+            if (foundChore) {
+                wxMessageBox("FOUND CHORE", "Found chore", wxOK | wxICON_INFORMATION);
             }
-            if (!foundChore)
+            else
             {
                 throw runtime_error("Chore not Found, Try Again");
             }
@@ -1350,15 +6568,15 @@ namespace ChoreAppNamespace {
     //SORT CHORES FRAME
     class SortFrame : public wxFrame {
     public:
-        SortFrame(const wxString& title, const wxPoint& pos, const wxSize& size);
+        SortFrame(const wxString& title, const wxPoint& pos, const wxSize& size, ChoreManager* choreManager);
 
     private:
         void OnChoreSelected(wxCommandEvent& event);
+        ChoreManager* m_choreManager; // Shared ChoreManager owned by ChoreApp
     };
 
-    SortFrame::SortFrame(const wxString& title, const wxPoint& pos, const wxSize& size)
-        : wxFrame(NULL, wxID_ANY, title, pos, size) {
-        ChoreManager choreManager(DATA_FILE_PATH + "data.json");
+    SortFrame::SortFrame(const wxString& title, const wxPoint& pos, const wxSize& size, ChoreManager* choreManager)
+        : wxFrame(NULL, wxID_ANY, title, pos, size), m_choreManager(choreManager) {
         wxBoxSizer* sizer = new wxBoxSizer(wxVERTICAL);
         wxChoice* choice = new wxChoice(this, wxID_ANY, wxDefaultPosition, wxDefaultSize, 0, NULL, 0);
 
@@ -1366,7 +6584,7 @@ namespace ChoreAppNamespace {
         choice->Append("ID");
         choice->Append("Earnings");
         // Loading chores into the choice menu
-        //for (const auto& chore : choreManager.displayChores()) {
+        //for (const auto& chore : m_choreManager->displayChores()) {
         //    choice->Append(chore->getName());
         //}
         wxMenu* sortMenu = new wxMenu();
@@ -1390,32 +6608,33 @@ namespace ChoreAppNamespace {
         }
         else if (selection == 1)
         {
-            //must be declared everytime
-            ChoreManager choreManager(DATA_FILE_PATH + "data.json");
-            //using the sort method of ChoreManager with share pointers
-            choreManager.sortChores([](const shared_ptr<Chore>& a, const shared_ptr<Chore>& b) {
-                //returning id data (can be switched for other sorts)
-                return a->getId() < b->getId();
-                });
+            //shared ChoreManager only re-reads the file if it changed on disk
+            m_choreManager->reloadIfChanged();
+            //sorting the rows of the columnar chore table leaves the stored chores in file order
+            const ChoreTable& table = m_choreManager->getChoreTable();
+            vector<ChoreTable::Row> rows = table.allRows();
+            table.sortById(rows);
             //this will be wrapped with all the output
             wxString sortedChores;
-            //cycle through the sorted chores which were dynamically changed above 
-            for (const auto& chore : choreManager.displayChores()) {
+            //cycle through the sorted rows, looking up the chore of each for its name
+            for (ChoreTable::Row row : rows) {
+                shared_ptr<Chore> chore = m_choreManager->getChoreById(table.getId(row));
                 //"%d" at the end is a placeholder for an integer.
-                sortedChores += "Chore: " + chore->getName() + "(ID: " + wxString::Format(wxT("%d"), chore->getId()) + ")\n";
+                sortedChores += "Chore: " + (chore ? chore->getName() : wxString()) + "(ID: " + wxString::Format(wxT("%d"), table.getId(row)) + ")\n";
             }
             //message box where this is displayed
             wxMessageBox(sortedChores, "Sorted Chores by ID", wxYES_NO | wxICON_INFORMATION);
         }
         else if (selection == 2)
         {
-            ChoreManager choreManager(DATA_FILE_PATH + "data.json");
-            choreManager.sortChores([](const shared_ptr<Chore>& a, const shared_ptr<Chore>& b) {
-                return a->getEarnings() > b->getEarnings();
-                });
+            m_choreManager->reloadIfChanged();
+            const ChoreTable& table = m_choreManager->getChoreTable();
+            vector<ChoreTable::Row> rows = table.allRows();
+            table.sortByEarnings(rows, false);
             wxString sortedChores;
-            for (const auto& chore : choreManager.displayChores()) {
-                sortedChores += "Chore: " + chore->getName() + "(Earnings: " + wxString::Format(wxT("%d"), chore->getEarnings()) + ")\n";
+            for (ChoreTable::Row row : rows) {
+                shared_ptr<Chore> chore = m_choreManager->getChoreById(table.getId(row));
+                sortedChores += "Chore: " + (chore ? chore->getName() : wxString()) + "(Earnings: " + wxString::Format(wxT("%d"), table.getEarnings(row)) + ")\n";
             }
             wxMessageBox(sortedChores, "Sorted Chores by Earnings", wxOK | wxICON_INFORMATION);
         }
@@ -1428,9 +6647,15 @@ namespace ChoreAppNamespace {
     //this frame is called in event.getid == 1... will display clickable chores
     class ChoresFrame : public wxFrame {
     public:
-        ChoresFrame(const wxString& title, const wxPoint& pos, const wxSize& size);
+        ChoresFrame(const wxString& title, const wxPoint& pos, const wxSize& size, ChoreManager* choreManager);
+        ~ChoresFrame();
 
     private:
+        ChoreManager* m_choreManager; // Shared ChoreManager owned by ChoreApp
+        wxChoice* m_choice;           // Chore names, each carrying its chore id as client data
+        int m_listener;               // Handle of the chore listener that keeps m_choice current
+        void FillChoices();
+        void OnChoreEvent(int choreId, CHORE_EVENT event);
         void OnChoreSelected(wxCommandEvent& event);
         //Added to save the chore to the user's personal list
         void SaveChoreToList(const Chore& selectedChore);
@@ -1438,9 +6663,9 @@ namespace ChoreAppNamespace {
 
     };
 
-    ChoresFrame::ChoresFrame(const wxString& title, const wxPoint& pos, const wxSize& size)
-        : wxFrame(NULL, wxID_ANY, title, pos, size) {
-        ChoreManager choreManager(DATA_FILE_PATH + "data.json");
+    ChoresFrame::ChoresFrame(const wxString& title, const wxPoint& pos, const wxSize& size, ChoreManager* choreManager)
+        : wxFrame(NULL, wxID_ANY, title, pos, size), m_choreManager(choreManager) {
+        m_choreManager->reloadIfChanged();
         wxBoxSizer* sizer = new wxBoxSizer(wxVERTICAL);
 
         //Adding a label above the choice drop down menu
@@ -1448,41 +6673,78 @@ namespace ChoreAppNamespace {
         sizer->Add(label, 0, wxEXPAND | wxALL, 5);
 
         //Creating the choice (dropdown) widget
-        wxChoice* choice = new wxChoice(this, wxID_ANY, wxDefaultPosition, wxDefaultSize, 0, NULL, 0);
-
-        //Adding a default option to the choice menu
-        choice->Append("Select Chore");
-
-        // Loading chores into the choice menu from the JSON file
-        for (const auto& chore : choreManager.displayChores()) {
-            choice->Append(chore->getName());
-        }
+        m_choice = new wxChoice(this, wxID_ANY, wxDefaultPosition, wxDefaultSize, 0, NULL, 0);
+        FillChoices();
 
         //Adding the choice widget to the sizer
-        sizer->Add(choice, 1, wxEXPAND | wxALL, 10);
+        sizer->Add(m_choice, 1, wxEXPAND | wxALL, 10);
         SetSizerAndFit(sizer);
 
         //even handler for the clickable menu
-        //crucial because whatever we put in choice in the for loop above will be clickable
-        choice->Bind(wxEVT_CHOICE, &ChoresFrame::OnChoreSelected, this);
+        //crucial because whatever we put in choice in FillChoices will be clickable
+        m_choice->Bind(wxEVT_CHOICE, &ChoresFrame::OnChoreSelected, this);
+        // External edits of the data file update just the affected entries
+        m_listener = m_choreManager->addChoreListener([this](int choreId, CHORE_EVENT event) { OnChoreEvent(choreId, event); });
+    }
+
+    ChoresFrame::~ChoresFrame() {
+        m_choreManager->removeChoreListener(m_listener);
+    }
+
+    void ChoresFrame::FillChoices() {
+        m_choice->Clear();
+        //Adding a default option to the choice menu
+        m_choice->Append("Select Chore");
+
+        // Loading chore names into the choice menu (lazy loading builds a chore only once it is selected)
+        for (const auto& title : m_choreManager->getChoreTitles()) {
+            m_choice->Append(title.second, reinterpret_cast<void*>(static_cast<intptr_t>(title.first)));
+        }
+    }
+
+    void ChoresFrame::OnChoreEvent(int choreId, CHORE_EVENT event) {
+        if (event == CHORE_EVENT::RELOADED) {
+            FillChoices();
+            return;
+        }
+        int item = wxNOT_FOUND;
+        for (unsigned int i = 1; i < m_choice->GetCount(); i++) {
+            if (static_cast<int>(reinterpret_cast<intptr_t>(m_choice->GetClientData(i))) == choreId) {
+                item = static_cast<int>(i);
+                break;
+            }
+        }
+        if (event == CHORE_EVENT::REMOVED) {
+            if (item != wxNOT_FOUND) {
+                m_choice->Delete(item);
+            }
+            return;
+        }
+        shared_ptr<Chore> chore = m_choreManager->getChoreById(choreId);
+        if (!chore) {
+            return;
+        }
+        if (item == wxNOT_FOUND) {
+            m_choice->Append(chore->getName(), reinterpret_cast<void*>(static_cast<intptr_t>(choreId)));
+        }
+        else {
+            m_choice->SetString(item, chore->getName());
+        }
     }
 
     // Inside the ChoresFrame class definition
     // Method to save the selected chore to the user's personal list
     void ChoresFrame::SaveChoreToList(const Chore& selectedChore) {
-        std::ofstream outFile("UserChoreList.json", std::ios::app);
-
-        if (!outFile) {
-            wxMessageBox("Unable to open or create 'UserChoreList.json' file.", "File Error", wxOK | wxICON_ERROR);
+        switch (m_choreManager->getPersonalList().add(selectedChore)) {
+        case LIST_SAVE::FAILED:
+            wxMessageBox("Unable to open or create 'UserChoreList.jsonl' file.", "File Error", wxOK | wxICON_ERROR);
             return;
+        case LIST_SAVE::ALREADY_SAVED:
+            wxMessageBox("This chore is already in your personal list.", "Already Saved", wxOK | wxICON_INFORMATION);
+            return;
+        default:
+            wxMessageBox("Chore saved successfully to your personal list!", "Save Successful", wxOK | wxICON_INFORMATION);
         }
-
-        // Convert chore details to JSON format and write them to the file
-        json choreData = selectedChore.toJSON();
-        outFile << std::setw(4) << choreData << std::endl;
-        outFile.close();
-
-        wxMessageBox("Chore saved successfully to your personal list!", "Save Successful", wxOK | wxICON_INFORMATION);
     }
 
 
@@ -1498,12 +6760,13 @@ namespace ChoreAppNamespace {
         //intuitively knows its location on the menu
         if (selection > 0)
         {
-            //this line recieves the event that occurred when you click a chore
-            wxChoice* choice = dynamic_cast<wxChoice*>(event.GetEventObject());
-            //the name of the chore is needed for the parameters of the getChoresByName
-            wxString selectedChoreName = choice->GetString(selection);
-            ChoreManager choreManager(DATA_FILE_PATH + "data.json");
-            shared_ptr<Chore> selectedChore = choreManager.getChoreByName(selectedChoreName);
+            //each entry carries the id of its chore, so chores sharing a name are told apart
+            int selectedChoreId = static_cast<int>(reinterpret_cast<intptr_t>(m_choice->GetClientData(selection)));
+            m_choreManager->reloadIfChanged();
+            shared_ptr<Chore> selectedChore = m_choreManager->getChoreById(selectedChoreId);
+            if (!selectedChore) {
+                return;
+            }
 
             wxString message;
             message += selectedChore->getName() + "\n";
@@ -1653,23 +6916,43 @@ namespace ChoreAppNamespace {
         if (event.GetId() == 1)
         {
             //this transfers control to the frame created ChoresFrame....it has its own binding event for when a chore is clicked
-            ChoresFrame* choresFrame = new ChoresFrame("SELECT CHORE", wxDefaultPosition, wxSize(300, 200));
+            ChoresFrame* choresFrame = new ChoresFrame("SELECT CHORE", wxDefaultPosition, wxSize(300, 200), m_choreManager);
             choresFrame->Show(true);
 
         }
         else if (event.GetId() == 2)
         {
-            SortFrame* sortFrame = new SortFrame("SELECT CHORE", wxDefaultPosition, wxSize(300, 200));
+            SortFrame* sortFrame = new SortFrame("SELECT CHORE", wxDefaultPosition, wxSize(300, 200), m_choreManager);
             sortFrame->Show(true);
             //SORT CHORES USED implement a sort frame here
         }
         else if (event.GetId() == 3)
         {
             //SEARCH CHORES USED
-            SearchFrame* searchFrame = new SearchFrame("SEARCH", wxDefaultPosition, wxSize(300, 200));
+            SearchFrame* searchFrame = new SearchFrame("SEARCH", wxDefaultPosition, wxSize(300, 200), m_choreManager);
             searchFrame->Show(true);
         }
     }
+    //*********************************************************************************************************************
+    // Log target of the command line modes: messages go to stderr, and errors are counted for the exit status
+    class HeadlessLog : public wxLogStderr {
+    private:
+        size_t errorCount = 0;
+
+    protected:
+        virtual void DoLogRecord(wxLogLevel level, const wxString& msg, const wxLogRecordInfo& info) {
+            if (level <= wxLOG_Error) {
+                errorCount++;
+            }
+            wxLogStderr::DoLogRecord(level, msg, info);
+        }
+
+    public:
+        size_t getErrorCount() const {
+            return errorCount;
+        }
+    };
+
     //*********************************************************************************************************************
     // Create the subclass of wxApp
     // ChoreApp serves as the application object
@@ -1678,16 +6961,142 @@ namespace ChoreAppNamespace {
     // ChoreApp serves as the application object
     class ChoreApp : public wxApp {
     private:
+        std::unique_ptr<ProfileStore> m_profiles;     // Registered users and their data partitions
         std::unique_ptr<ChoreManager> m_choreManager; // Pointer to a global ChoreManager instance
+        int m_exitCode = 0;                           // Exit status of a command line mode
+
+        // Open the logged-in user's own data file; a new partition starts with no chores
+        void openUserData(const wxString& username) {
+            wxString dataFile = m_profiles->getDataFile(username);
+            if (!wxFileExists(dataFile)) {
+                writeFileAtomically(dataFile, serializeSnapshot(json{ {SCHEMA_KEY, SCHEMA_VERSION}, {"chores", json::array()} }, SNAPSHOT_FORMAT::JSON));
+            }
+            m_choreManager = std::make_unique<ChoreManager>(dataFile, LOAD_MODE::LAZY);
+            json profile = m_profiles->getProfile(username);
+            m_choreManager->setUserProfile(username, wxString(profile.value("theme", "light")), profile.value("notify", false));
+        }
 
     public:
+        // The watcher needs the main event loop; modal loops such as the login dialog's come earlier
+        virtual void OnEventLoopEnter(wxEventLoopBase* loop) {
+            wxApp::OnEventLoopEnter(loop);
+            if (loop->IsMain() && m_choreManager) {
+                m_choreManager->watchDataFile();
+            }
+        }
+
+        // Make sure queued snapshot writes reach disk before the application exits
+        virtual int OnExit() {
+            if (m_choreManager) {
+                m_choreManager->flush();
+                wxLogDebug("%s", m_choreManager->getWriter().describeStats());
+            }
+            return wxApp::OnExit();
+        }
+
+        // Run the command line mode named by argv, if any; false if there is none and the GUI should start
+        bool runCommandLine() {
+            wxString mode = argc >= 2 ? wxString(argv[1]) : wxString();
+            bool known = (mode == "--import" && argc >= 3) || (mode == "--export" && argc >= 3) || (mode == "--report" && argc >= 4)
+                || mode == "--bench-recovery" || (mode == "--sync" && argc >= 4);
+            if (!known) {
+                return false;
+            }
+            runningHeadless = true;
+            attachConsole();
+            HeadlessLog* log = new HeadlessLog();
+            delete wxLog::SetActiveTarget(log);
+
+            bool ok = true;
+            // Headless bulk import: ChoreApp --import <feed.csv|feed.jsonl> [data file]
+            if (mode == "--import") {
+                wxString dataFile = argc >= 4 ? wxString(argv[3]) : DATA_FILE_PATH + "data.json";
+                ChoreManager manager(dataFile);
+                ImportReport report = manager.importChores(argv[2]);
+                std::cout << report.describe().ToStdString() << std::endl;
+            }
+            // Headless export of every chore: ChoreApp --export <out.csv|out.jsonl> [data file]
+            else if (mode == "--export") {
+                wxString dataFile = argc >= 4 ? wxString(argv[3]) : DATA_FILE_PATH + "data.json";
+                ChoreManager manager(dataFile, LOAD_MODE::LAZY);
+                ExportOptions options;
+                options.format = feedFormatForFile(argv[2]);
+                std::cout << "Exported " << manager.exportChores(argv[2], options) << " rows" << std::endl;
+            }
+            // Headless summary: ChoreApp --report <day|status|difficulty> <out.csv|out.jsonl> [data file]
+            else if (mode == "--report") {
+                wxString kind = argv[2];
+                if (kind != "day" && kind != "status" && kind != "difficulty") {
+                    wxLogError("Unknown report: %s (expected day, status or difficulty)", kind);
+                }
+                else {
+                    wxString dataFile = argc >= 5 ? wxString(argv[4]) : DATA_FILE_PATH + "data.json";
+                    ChoreManager manager(dataFile, LOAD_MODE::LAZY);
+                    REPORT report = kind == "day" ? REPORT::BY_DAY : kind == "status" ? REPORT::BY_STATUS : REPORT::BY_DIFFICULTY;
+                    std::cout << "Reported " << manager.exportReport(argv[3], report, feedFormatForFile(argv[3])) << " rows" << std::endl;
+                }
+            }
+            // Recovery timings on synthetic datasets: ChoreApp --bench-recovery [scratch directory]
+            else if (mode == "--bench-recovery") {
+                ok = runRecoveryBenchmark(DATA_FILE_PATH + "data.json", argc >= 3 ? wxString(argv[2]) : DATA_FILE_PATH + "bench", std::cout);
+            }
+            // Headless delta sync through a drop directory: ChoreApp --sync <directory> <peer name> [data file]
+            else {
+                wxString dataFile = argc >= 5 ? wxString(argv[4]) : DATA_FILE_PATH + "data.json";
+                ChoreManager manager(dataFile, LOAD_MODE::LAZY);
+                FileDropSync sync(argv[2], argv[3]);
+                std::cout << sync.receive(manager).describe().ToStdString() << std::endl;
+                std::cout << (sync.send(manager) ? "Sent changes" : "Nothing to send") << std::endl;
+                manager.saveData();
+            }
+            // Failed loads, saves and exports are logged; those of the snapshot writer thread are counted once flushed
+            wxLog::FlushActive();
+            m_exitCode = ok && log->getErrorCount() == 0 ? 0 : 1;
+            return true;
+        }
+
+        // The executable uses the Windows subsystem and has no console of its own; borrow the one of the
+        // shell that started it, or open one, so the command line modes can print their results
+        static void attachConsole() {
+#ifdef __WXMSW__
+            if (AttachConsole(ATTACH_PARENT_PROCESS) || AllocConsole()) {
+                FILE* stream = nullptr;
+                freopen_s(&stream, "CONOUT$", "w", stdout);
+                freopen_s(&stream, "CONOUT$", "w", stderr);
+                std::cout.clear();
+                std::cerr.clear();
+            }
+#endif
+        }
+
+        // Status of a command line run; the main loop is never entered for one
+        virtual int OnRun() {
+            return runningHeadless ? m_exitCode : wxApp::OnRun();
+        }
+
         virtual bool OnInit() {
-            // Initialize the ChoreManager object once for the entire application
-            m_choreManager = std::make_unique<ChoreManager>(DATA_FILE_PATH + "data.json");
+            if (runCommandLine()) {
+                return true;  // OnRun hands back the status; returning false here would always report a failure
+            }
+
+            // Profiles live in their own store; the first run moves them out of the shared data file
+            wxString usersDir = DATA_FILE_PATH + "users";
+            bool firstRun = !wxDirExists(usersDir);
+            m_profiles = std::make_unique<ProfileStore>(usersDir);
+            if (firstRun) {
+                m_profiles->importLegacyProfiles(DATA_FILE_PATH + "data.json");
+            }
 
             // Create and show the login dialog
-            LoginDialog* loginFrame = new LoginDialog(nullptr, m_choreManager.get());
-            loginFrame->ShowModal();
+            LoginDialog* loginFrame = new LoginDialog(nullptr, m_profiles.get());
+            if (loginFrame->ShowModal() == wxID_OK) {
+                // Load only the logged-in user's chores
+                openUserData(loginFrame->getUsername());
+            }
+            else {
+                m_choreManager = std::make_unique<ChoreManager>(DATA_FILE_PATH + "data.json", LOAD_MODE::LAZY);
+            }
+            loginFrame->Destroy();
 
             // Create and show the main frame
             MyFrame* frame = new MyFrame("Chore Manager", wxPoint(50, 50), wxSize(450, 340), m_choreManager.get());
@@ -1698,16 +7107,17 @@ namespace ChoreAppNamespace {
         // LoginDialog handles user login and new user creation
         class LoginDialog : public wxDialog {
         private:
-            ChoreManager* m_choreManager;       // Pointer to the shared ChoreManager
+            ProfileStore* m_profiles;           // Pointer to the shared profile store
+            wxString m_username;                // Set once the user has logged in
             wxTextCtrl* m_usernameText;         // Text control for the username
             wxChoice* m_themeChoice;            // Choice control for theme selection
             wxCheckBox* m_notifyCheckBox;       // Checkbox for notifications
 
         public:
             // Constructor initializes the login dialog
-            LoginDialog(wxWindow* parent, ChoreManager* choreManager)
+            LoginDialog(wxWindow* parent, ProfileStore* profiles)
                 : wxDialog(parent, wxID_ANY, wxT("Login or Register"), wxDefaultPosition, wxDefaultSize),
-                m_choreManager(choreManager) {
+                m_profiles(profiles) {
                 // Setup UI components for login
                 wxBoxSizer* sizer = new wxBoxSizer(wxVERTICAL);
                 wxStaticText* usernameLabel = new wxStaticText(this, wxID_ANY, wxT("Username:"));
@@ -1750,18 +7160,26 @@ namespace ChoreAppNamespace {
                 wxString theme = m_themeChoice->GetStringSelection();
                 bool notify = m_notifyCheckBox->IsChecked();
 
-                if (!m_choreManager->userExists(username)) {
-                    m_choreManager->createUser(username, theme, notify);
+                bool existing = m_profiles->exists(username);
+                if (!m_profiles->saveProfile(username, theme, notify)) {
+                    wxMessageBox("Unable to save the profile for " + username + ".", "File Error", wxOK | wxICON_ERROR);
+                    return;
+                }
+                if (!existing) {
                     wxMessageBox("New user created: " + username + ". Welcome to Chore Manager!", "User Created", wxOK | wxICON_INFORMATION);
                 }
                 else {
-                    m_choreManager->updateUser(username, theme, notify);
                     wxMessageBox("Welcome back, " + username + "!", "Login Success", wxOK | wxICON_INFORMATION);
                 }
 
                 // Close the dialog
+                m_username = username;
                 EndModal(wxID_OK);
             }
+
+            wxString getUsername() const {
+                return m_username;
+            }
         };
     };
 }